@@ -0,0 +1,848 @@
+#define _POSIX_C_SOURCE 200809L // For clock_gettime
+
+#include "../src/list.h"
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Times the functions of list.h at growing sizes, against whichever backend
+// it is linked with, and prints the results as JSON on stdout (and as a table
+// on stderr). Usage: bench [max_size], sizes go 1e3, 1e4, ... up to max_size.
+
+#ifndef BENCH_BACKEND
+#define BENCH_BACKEND "unknown"
+#endif
+
+#define VALUES 4096      // Distinct elements, so duplicates and sorts happen
+#define WORK (1L << 24)  // Nodes visited by the O(n) benchmarks at any size
+#define MAX_LISTS 100000 // Lists kept at once by the splice benchmark
+
+/*******************************************************************************
+ Allocation counting. Linked with -Wl,--wrap=malloc (and calloc, realloc), so
+ every allocation made by the list goes through these first.
+ ******************************************************************************/
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* pointer, size_t size);
+
+static long allocations = 0; // Since the program started
+static long allocated_bytes = 0;
+
+void* __wrap_malloc(size_t size)
+{
+    allocations++;
+    allocated_bytes += size;
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size)
+{
+    allocations++;
+    allocated_bytes += count * size;
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* pointer, size_t size)
+{
+    allocations++;
+    allocated_bytes += size;
+    return __real_realloc(pointer, size);
+}
+
+/*******************************************************************************
+ Measuring. Each benchmark builds what it needs, then surrounds only the
+ calls being measured with bench_start and bench_stop.
+ ******************************************************************************/
+
+typedef struct Measure_
+{
+        long ops; // Calls, or elements for functions over the whole list
+        double ns;
+        long allocations;
+        long bytes;
+} Measure; // Struct = struct Measure_ ; Value = Measure
+
+static Measure measure;
+static struct timespec start_time;
+static long start_allocations;
+static long start_bytes;
+
+void bench_start()
+{
+    start_allocations = allocations;
+    start_bytes = allocated_bytes;
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+}
+
+void bench_stop(long ops)
+{
+    struct timespec stop_time;
+    clock_gettime(CLOCK_MONOTONIC, &stop_time);
+    measure.ops = ops;
+    measure.ns = (stop_time.tv_sec - start_time.tv_sec) * 1e9 +
+                 (stop_time.tv_nsec - start_time.tv_nsec);
+    measure.allocations = allocations - start_allocations;
+    measure.bytes = allocated_bytes - start_bytes;
+}
+
+ListIndex repeats(ListIndex size) // O(n) calls that fit in WORK, 1 to size
+{
+    long count = WORK / size;
+    return count < 1 ? 1 : count > size ? size : (ListIndex)count;
+}
+
+/*******************************************************************************
+ Elements.
+ ******************************************************************************/
+
+static int values[VALUES];
+static int absent;         // Never in any list
+static volatile long sink; // Keeps results the compiler could drop
+
+void* element_at(long i) // Spreads i over the values, in no particular order
+{
+    return &values[(unsigned long)i * 2654435761u % VALUES];
+}
+
+List list_of(ListIndex size) // O(n)
+{
+    List list = list_create();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        list_insert_last(list, element_at(i));
+    }
+    return list;
+}
+
+bool is_equal(void* a, void* b) { return a == b; }
+
+size_t hash_address(void* a) { return (size_t)a; }
+
+int compare_values(void* a, void* b) { return *(int*)a - *(int*)b; }
+
+void* next_value(void* a) { return &values[(*(int*)a + 1) % VALUES]; }
+
+bool is_even(void* a) { return *(int*)a % 2 == 0; }
+
+bool is_value(void* a) { return a != &absent; }
+
+bool is_absent(void* a) { return a == &absent; }
+
+void print_nothing(void* a) { sink += a == NULL; } // No I/O to time
+
+void count_into(void* a, void* ctx)
+{
+    (void)a;
+    (*(long*)ctx)++;
+}
+
+void* count_fold(void* accumulated, void* a, void* ctx)
+{
+    (void)a;
+    (void)ctx;
+    return (char*)accumulated + 1; // Counts in the pointer itself
+}
+
+/*******************************************************************************
+ Benchmarks, one per function (or way of calling it).
+ ******************************************************************************/
+
+void bench_insert_first(ListIndex size)
+{
+    List list = list_create();
+    bench_start();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        list_insert_first(list, element_at(i));
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_insert_last(ListIndex size)
+{
+    List list = list_create();
+    bench_start();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        list_insert_last(list, element_at(i));
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_insert_last_pooled(ListIndex size)
+{
+    List list = list_create_pooled(1024);
+    bench_start();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        list_insert_last(list, element_at(i));
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_insert(ListIndex size)
+{
+    List list = list_of(size);
+    ListIndex count = repeats(size);
+    bench_start();
+    for (ListIndex i = 0; i < count; i++) // In the middle
+    {
+        list_insert(list, element_at(i), size / 2);
+    }
+    bench_stop(count);
+    list_destroy(list, NULL);
+}
+
+void bench_insert_last_bulk(ListIndex size)
+{
+    void** array = malloc(size * sizeof(void*));
+    for (ListIndex i = 0; i < size; i++)
+    {
+        array[i] = element_at(i);
+    }
+    List list = list_create();
+    bench_start();
+    list_insert_last_bulk(list, array, size);
+    bench_stop(size);
+    list_destroy(list, NULL);
+    free(array);
+}
+
+void bench_from_array(ListIndex size)
+{
+    void** array = malloc(size * sizeof(void*));
+    for (ListIndex i = 0; i < size; i++)
+    {
+        array[i] = element_at(i);
+    }
+    bench_start();
+    List list = list_from_array(array, size);
+    bench_stop(size);
+    list_destroy(list, NULL);
+    free(array);
+}
+
+void bench_remove_first(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        list_remove_first(list);
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_remove_last(ListIndex size)
+{
+    List list = list_of(size);
+    ListIndex count = repeats(size);
+    bench_start();
+    for (ListIndex i = 0; i < count; i++)
+    {
+        list_remove_last(list);
+    }
+    bench_stop(count);
+    list_destroy(list, NULL);
+}
+
+void bench_remove_last_doubly(ListIndex size)
+{
+    List list = list_create_doubly();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        list_insert_last(list, element_at(i));
+    }
+    bench_start();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        list_remove_last(list);
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_remove(ListIndex size)
+{
+    List list = list_of(size);
+    ListIndex count = repeats(size);
+    bench_start();
+    for (ListIndex i = 0; i < count; i++) // From the middle
+    {
+        list_remove(list, (size - i) / 2);
+    }
+    bench_stop(count);
+    list_destroy(list, NULL);
+}
+
+void bench_get_first_last(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        sink += list_get_first(list) == list_get_last(list);
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_size_is_empty(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        sink += list_size(list) + list_is_empty(list);
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_get(ListIndex size)
+{
+    List list = list_of(size);
+    ListIndex count = repeats(size);
+    unsigned int position = 12345;
+    bench_start();
+    for (ListIndex i = 0; i < count; i++) // At scattered positions
+    {
+        position = position * 1103515245u + 12345u;
+        sink += list_get(list, position % size) == NULL;
+    }
+    bench_stop(count);
+    list_destroy(list, NULL);
+}
+
+void bench_get_sequential(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        sink += list_get(list, i) == NULL;
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_get_indexed(ListIndex size)
+{
+    List list = list_of(size);
+    list_set_indexed(list, true); // Does nothing in the unrolled backend,
+    ListIndex count = repeats(size);    // hence only repeats(size) calls
+    unsigned int position = 12345;
+    bench_start();
+    for (ListIndex i = 0; i < count; i++) // At scattered positions
+    {
+        position = position * 1103515245u + 12345u;
+        sink += list_get(list, position % size) == NULL;
+    }
+    bench_stop(count);
+    list_destroy(list, NULL);
+}
+
+void bench_set_indexed(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_set_indexed(list, true);
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_find(ListIndex size)
+{
+    List list = list_of(size);
+    ListIndex count = repeats(size);
+    bench_start();
+    for (ListIndex i = 0; i < count; i++) // Absent, so the whole list is read
+    {
+        sink += list_find(list, is_equal, &absent);
+    }
+    bench_stop(count);
+    list_destroy(list, NULL);
+}
+
+void bench_find_hashed(ListIndex size)
+{
+    List list = list_of(size);
+    list_set_hash_index(list, hash_address, is_equal);
+    bench_start();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        sink += list_find(list, is_equal, &absent);
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_set_hash_index(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_set_hash_index(list, hash_address, is_equal);
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_count_all(ListIndex size)
+{
+    List list = list_of(size);
+    ListIndex count = repeats(size);
+    bench_start();
+    for (ListIndex i = 0; i < count; i++)
+    {
+        sink += list_count_all(list, is_equal, element_at(i));
+    }
+    bench_stop(count);
+    list_destroy(list, NULL);
+}
+
+void bench_remove_all(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_remove_all(list, is_equal, NULL, element_at(0));
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_remove_duplicates(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_remove_duplicates(list, is_equal, NULL, element_at(0));
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_unique(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_unique(list, hash_address, is_equal, NULL);
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_sort(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_sort(list, compare_values);
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_join(ListIndex size)
+{
+    List list1 = list_of(size / 2);
+    List list2 = list_of(size - size / 2);
+    bench_start();
+    List list = list_join(list1, list2);
+    bench_stop(size);
+    list_destroy(list, NULL);
+    list_destroy(list1, NULL);
+    list_destroy(list2, NULL);
+}
+
+void bench_splice(ListIndex size)
+{
+    ListIndex count = size < MAX_LISTS ? size : MAX_LISTS;
+    List* lists = malloc(count * sizeof(List));
+    for (ListIndex i = 0; i < count; i++)
+    {
+        lists[i] = list_of(1);
+    }
+    List list = list_of(size);
+    bench_start();
+    for (ListIndex i = 0; i < count; i++)
+    {
+        list_splice(list, lists[i]);
+    }
+    bench_stop(count);
+    for (ListIndex i = 0; i < count; i++)
+    {
+        list_destroy(lists[i], NULL);
+    }
+    list_destroy(list, NULL);
+    free(lists);
+}
+
+void bench_get_sublist_between(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    List sublist = list_get_sublist_between(list, size / 4, size / 4 * 3);
+    bench_stop(size);
+    list_destroy(sublist, NULL);
+    list_destroy(list, NULL);
+}
+
+void bench_get_sublist(ListIndex size)
+{
+    List list = list_of(size);
+    ListIndex* indexes = malloc((size / 2 + 1) * sizeof(ListIndex));
+    for (ListIndex i = 0; i < size / 2; i++) // Every other position
+    {
+        indexes[i] = 2 * i;
+    }
+    bench_start();
+    List sublist = list_get_sublist(list, indexes, size / 2);
+    bench_stop(size);
+    list_destroy(sublist, NULL);
+    list_destroy(list, NULL);
+    free(indexes);
+}
+
+void bench_to_array(ListIndex size)
+{
+    List list = list_of(size);
+    void** array = malloc(size * sizeof(void*));
+    bench_start();
+    list_to_array(list, array);
+    bench_stop(size);
+    list_destroy(list, NULL);
+    free(array);
+}
+
+void bench_map(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    List mapped = list_map(list, next_value);
+    bench_stop(size);
+    list_destroy(mapped, NULL);
+    list_destroy(list, NULL);
+}
+
+void bench_map_inplace(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_map_inplace(list, next_value, NULL);
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_for_each(ListIndex size)
+{
+    List list = list_of(size);
+    long count = 0;
+    bench_start();
+    list_for_each(list, count_into, &count);
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_filter(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    List filtered = list_filter(list, is_even);
+    bench_stop(size);
+    list_destroy(filtered, NULL);
+    list_destroy(list, NULL);
+}
+
+void bench_retain(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_retain(list, is_even, NULL);
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_reduce(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_reduce(list, NULL, count_fold, NULL);
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_all(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_all(list, is_value); // True, so the whole list is checked
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_any(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_any(list, is_absent); // False, so the whole list is checked
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_find_if(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_find_if(list, is_absent); // Not found, so the whole list is checked
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_iterator(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_iterator_start(list);
+    while (list_iterator_has_next(list))
+    {
+        list_iterator_get_next(list);
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_iter_next(ListIndex size)
+{
+    List list = list_of(size);
+    ListIter iter;
+    bench_start();
+    list_iter_init(&iter, list);
+    while (list_iter_has_next(&iter))
+    {
+        list_iter_next(&iter);
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_iter_peek(ListIndex size)
+{
+    List list = list_of(size);
+    ListIter iter;
+    bench_start();
+    list_iter_init(&iter, list);
+    while (list_iter_peek(&iter) != NULL) // Elements are never NULL
+    {
+        list_iter_next(&iter);
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_iter_previous_doubly(ListIndex size)
+{
+    List list = list_create_doubly();
+    for (ListIndex i = 0; i < size; i++)
+    {
+        list_insert_last(list, element_at(i));
+    }
+    ListIter iter;
+    bench_start();
+    list_iter_init_last(&iter, list);
+    while (list_iter_has_previous(&iter))
+    {
+        list_iter_previous(&iter);
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_iter_remove(ListIndex size)
+{
+    List list = list_of(size);
+    ListIter iter;
+    bench_start();
+    list_iter_init(&iter, list);
+    while (list_iter_has_next(&iter)) // Every other element
+    {
+        list_iter_next(&iter);
+        if (list_iter_has_next(&iter))
+        {
+            list_iter_next(&iter);
+            list_iter_remove(&iter);
+        }
+    }
+    bench_stop(size / 2);
+    list_destroy(list, NULL);
+}
+
+void bench_iter_insert_after(ListIndex size)
+{
+    List list = list_of(size);
+    ListIter iter;
+    bench_start();
+    list_iter_init(&iter, list);
+    while (list_iter_has_next(&iter)) // After every element
+    {
+        list_iter_insert_after(&iter, element_at(0));
+        list_iter_next(&iter);
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_iter_insert_before(ListIndex size)
+{
+    List list = list_of(size);
+    ListIter iter;
+    bench_start();
+    list_iter_init(&iter, list);
+    while (list_iter_has_next(&iter)) // Before every element
+    {
+        list_iter_next(&iter);
+        list_iter_insert_before(&iter, element_at(0));
+    }
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_print(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_print(list, print_nothing); // Only the traversal, not the printing
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_make_empty(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_make_empty(list, NULL);
+    bench_stop(size);
+    list_destroy(list, NULL);
+}
+
+void bench_destroy(ListIndex size)
+{
+    List list = list_of(size);
+    bench_start();
+    list_destroy(list, NULL);
+    bench_stop(size);
+}
+
+typedef struct Bench_
+{
+        const char* name; // Function measured (and how, after a colon)
+        void (*run)(ListIndex size);
+} Bench; // Struct = struct Bench_ ; Value = Bench
+
+static const Bench benches[] = {
+    {"list_insert_first", bench_insert_first},
+    {"list_insert_last", bench_insert_last},
+    {"list_insert_last:pooled", bench_insert_last_pooled},
+    {"list_insert:middle", bench_insert},
+    {"list_insert_last_bulk", bench_insert_last_bulk},
+    {"list_from_array", bench_from_array},
+    {"list_remove_first", bench_remove_first},
+    {"list_remove_last", bench_remove_last},
+    {"list_remove_last:doubly", bench_remove_last_doubly},
+    {"list_remove:middle", bench_remove},
+    {"list_get_first+list_get_last", bench_get_first_last},
+    {"list_size+list_is_empty", bench_size_is_empty},
+    {"list_get:scattered", bench_get},
+    {"list_get:sequential", bench_get_sequential},
+    {"list_get:indexed", bench_get_indexed},
+    {"list_set_indexed", bench_set_indexed},
+    {"list_find:absent", bench_find},
+    {"list_find:hashed", bench_find_hashed},
+    {"list_set_hash_index", bench_set_hash_index},
+    {"list_count_all", bench_count_all},
+    {"list_remove_all", bench_remove_all},
+    {"list_remove_duplicates", bench_remove_duplicates},
+    {"list_unique", bench_unique},
+    {"list_sort", bench_sort},
+    {"list_join", bench_join},
+    {"list_splice", bench_splice},
+    {"list_get_sublist_between", bench_get_sublist_between},
+    {"list_get_sublist", bench_get_sublist},
+    {"list_to_array", bench_to_array},
+    {"list_map", bench_map},
+    {"list_map_inplace", bench_map_inplace},
+    {"list_for_each", bench_for_each},
+    {"list_filter", bench_filter},
+    {"list_retain", bench_retain},
+    {"list_reduce", bench_reduce},
+    {"list_all", bench_all},
+    {"list_any", bench_any},
+    {"list_find_if", bench_find_if},
+    {"list_iterator_get_next", bench_iterator},
+    {"list_iter_next", bench_iter_next},
+    {"list_iter_peek+list_iter_next", bench_iter_peek},
+    {"list_iter_previous:doubly", bench_iter_previous_doubly},
+    {"list_iter_remove", bench_iter_remove},
+    {"list_iter_insert_after", bench_iter_insert_after},
+    {"list_iter_insert_before", bench_iter_insert_before},
+    {"list_print", bench_print},
+    {"list_make_empty", bench_make_empty},
+    {"list_destroy", bench_destroy},
+};
+
+int main(int argc, char** argv)
+{
+    long long max_size = argc > 1 ? atoll(argv[1]) : 1000000;
+    if (max_size < 1000 || max_size > LIST_INDEX_MAX) // Sizes are ListIndex
+    {
+        fprintf(
+            stderr,
+            "usage: %s [max_size, 1000 to %lld]\n",
+            argv[0],
+            (long long)LIST_INDEX_MAX
+        );
+        return 1;
+    }
+    unsigned int seed = 2463534242u;
+    for (int i = 0; i < VALUES; i++) // Same values on every run
+    {
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        values[i] = (int)(seed % 1000000);
+    }
+    printf("{\"backend\": \"%s\", \"results\": [", BENCH_BACKEND);
+    bool first = true;
+    for (long long size = 1000; size <= max_size; size *= 10)
+    {
+        for (size_t i = 0; i < sizeof(benches) / sizeof(Bench); i++)
+        {
+            benches[i].run((ListIndex)size);
+            double ops = measure.ops > 0 ? measure.ops : 1;
+            printf(
+                "%s\n  {\"function\": \"%s\", \"size\": %lld, \"ops\": %ld, "
+                "\"ns_per_op\": %.2f, \"allocations_per_op\": %.3f, "
+                "\"bytes_per_op\": %.2f}",
+                first ? "" : ",",
+                benches[i].name,
+                size,
+                measure.ops,
+                measure.ns / ops,
+                measure.allocations / ops,
+                measure.bytes / ops
+            );
+            fprintf(
+                stderr,
+                "%-9s %-30s %10lld %12.2f ns/op %8.3f allocs/op %9.2f B/op\n",
+                BENCH_BACKEND,
+                benches[i].name,
+                size,
+                measure.ns / ops,
+                measure.allocations / ops,
+                measure.bytes / ops
+            );
+            first = false;
+        }
+    }
+    printf("\n]}\n");
+    return 0;
+}
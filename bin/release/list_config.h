@@ -0,0 +1,6 @@
+#pragma once
+
+// Generated by make: the library uses int sizes
+#ifdef LIST_SIZE_64
+#error "libsll was built with int sizes, without LIST_SIZE_64"
+#endif
@@ -0,0 +1,6 @@
+#pragma once
+
+// Generated by make install: the library uses 64-bit sizes
+#ifndef LIST_SIZE_64
+#define LIST_SIZE_64
+#endif
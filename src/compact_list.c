@@ -0,0 +1,358 @@
+#include "compact_list.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// A node is an index into the arrays of the list: its element is in
+// elements (or offsets) and the index of the next node in next. Since nodes
+// are indexes, the arrays can move when they grow without breaking any link
+
+#define NONE UINT32_MAX // Index of no node, like NULL for pointers
+#define MAX_NODES                                                              \
+    ((uintmax_t)LIST_INDEX_MAX < UINT32_MAX                                    \
+         ? (uint32_t)LIST_INDEX_MAX                                            \
+         : UINT32_MAX) // Indexes from 0 to NONE - 1, as long as the size still
+                       // fits in a ListIndex
+#define INITIAL_NODES 16
+
+struct CompactList_
+{
+        void** elements;     // Element of each node (NULL if by_offset)
+        uint32_t* offsets;   // Offset of each node's element from base
+        uint32_t* next;      // Index of the node after each node (or NONE)
+        char* base;          // Start of the caller's memory, if by_offset
+        bool by_offset;      // Elements stored as offsets instead of pointers
+        uint32_t head;       // Index of the first node (or NONE)
+        uint32_t tail;       // Index of the last node (or NONE)
+        uint32_t free_nodes; // Released nodes, chained through next
+        uint32_t used;       // Slots ever taken from the arena
+        uint32_t capacity;   // Slots the arrays have room for
+        ListIndex size;
+}; // Struct = struct CompactList_ ; Pointer = CompactList
+
+static void compact_grow(CompactList list, uint32_t capacity) // O(capacity)
+{
+    list->next = realloc(list->next, capacity * sizeof(uint32_t));
+    if (list->by_offset) // Only one of the element arrays is used
+    {
+        list->offsets = realloc(list->offsets, capacity * sizeof(uint32_t));
+    }
+    else
+    {
+        list->elements = realloc(list->elements, capacity * sizeof(void*));
+    }
+    list->capacity = capacity;
+}
+
+static void* compact_element(CompactList list, uint32_t node) // O(1)
+{
+    return list->by_offset ? list->base + list->offsets[node]
+                           : list->elements[node];
+}
+
+static uint32_t compact_node_create(
+    CompactList list,
+    void* element,
+    uint32_t next
+) // O(1) amortized, NONE if the arena is full
+{
+    uint32_t node = list->free_nodes;
+    if (node != NONE) // Reuses a released node first
+    {
+        list->free_nodes = list->next[node];
+    }
+    else
+    {
+        if (list->used == list->capacity) // Doubles the arena, up to the
+        {                                 // largest index
+            if (list->capacity == MAX_NODES)
+            {
+                return NONE;
+            }
+            uint32_t capacity = list->capacity > MAX_NODES / 2
+                                    ? MAX_NODES
+                                    : list->capacity * 2;
+            compact_grow(
+                list, capacity > INITIAL_NODES ? capacity : INITIAL_NODES
+            );
+        }
+        node = list->used++; // Takes a new slot
+    }
+    if (list->by_offset)
+    {
+        list->offsets[node] = (uint32_t)((char*)element - list->base);
+    }
+    else
+    {
+        list->elements[node] = element;
+    }
+    list->next[node] = next;
+    return node;
+}
+
+static void compact_node_release(CompactList list, uint32_t node) // O(1)
+{
+    list->next[node] = list->free_nodes; // Chains it for reuse
+    list->free_nodes = node;
+}
+
+static uint32_t compact_node_at(CompactList list, ListIndex position) // O(n)
+{
+    uint32_t node = list->head;
+    for (ListIndex i = 0; i < position; i++) // Walks to the position
+    {
+        node = list->next[node];
+    }
+    return node;
+}
+
+CompactList compact_list_create_with(bool by_offset, void* base) // O(1)
+{
+    CompactList list = malloc(sizeof(struct CompactList_));
+    list->elements = NULL; // The arena is allocated on the first insert
+    list->offsets = NULL;
+    list->next = NULL;
+    list->base = base;
+    list->by_offset = by_offset;
+    list->head = NONE;
+    list->tail = NONE;
+    list->free_nodes = NONE;
+    list->used = 0;
+    list->capacity = 0;
+    list->size = 0;
+    return list;
+}
+
+CompactList compact_list_create() // O(1)
+{
+    return compact_list_create_with(false, NULL);
+}
+
+CompactList compact_list_create_offsets(void* base) // O(1)
+{
+    return compact_list_create_with(true, base);
+}
+
+void compact_list_destroy(
+    CompactList list,
+    void (*free_element)(void*)
+) // O(n)
+{
+    compact_list_make_empty(list, free_element);
+    free(list);
+}
+
+void compact_list_reserve(CompactList list, ListIndex count) // O(n)
+{
+    if (count > (ListIndex)list->capacity) // Never shrinks (capacity is at
+    {                                      // most MAX_NODES, so it fits)
+        compact_grow(
+            list,
+            (uintmax_t)count < MAX_NODES ? (uint32_t)count : MAX_NODES
+        );
+    }
+}
+
+void compact_list_make_empty(
+    CompactList list,
+    void (*free_element)(void*)
+) // O(n)
+{
+    for (uint32_t node = list->head; free_element != NULL && node != NONE;
+         node = list->next[node]) // Frees the elements first
+    {
+        free_element(compact_element(list, node));
+    }
+    free(list->elements); // The whole arena at once, not node by node
+    free(list->offsets);
+    free(list->next);
+    list->elements = NULL;
+    list->offsets = NULL;
+    list->next = NULL;
+    list->head = NONE;
+    list->tail = NONE;
+    list->free_nodes = NONE;
+    list->used = 0;
+    list->capacity = 0;
+    list->size = 0;
+}
+
+bool compact_list_is_empty(CompactList list) // O(1)
+{
+    return list->size == 0;
+}
+
+ListIndex compact_list_size(CompactList list) // O(1)
+{
+    return list->size;
+}
+
+void* compact_list_get_first(CompactList list) // O(1)
+{
+    return list->head != NONE ? compact_element(list, list->head) : NULL;
+}
+
+void* compact_list_get_last(CompactList list) // O(1)
+{
+    return list->tail != NONE ? compact_element(list, list->tail) : NULL;
+}
+
+void* compact_list_get(CompactList list, ListIndex position) // O(n)
+{
+    if (position < 0 || position > list->size - 1) // Cannot access positions
+    {                                              // that do not exist
+        return NULL;
+    }
+    return compact_element(list, compact_node_at(list, position));
+}
+
+ListIndex compact_list_find(
+    CompactList list,
+    bool (*equal)(void*, void*),
+    void* element
+) // O(n)
+{
+    ListIndex position = 0;
+    for (uint32_t node = list->head; node != NONE; node = list->next[node])
+    {
+        if (equal(element, compact_element(list, node))) // If equal
+        {
+            return position;
+        }
+        position++;
+    }
+    return -1;
+}
+
+bool compact_list_insert_first(CompactList list, void* element) // O(1)
+{
+    uint32_t node = compact_node_create(list, element, list->head);
+    if (node == NONE) // The arena is full
+    {
+        return false;
+    }
+    list->head = node; // Becomes the head
+    if (list->tail == NONE) // If the list was empty, also the tail
+    {
+        list->tail = node;
+    }
+    list->size++;
+    return true;
+}
+
+bool compact_list_insert_last(CompactList list, void* element) // O(1)
+{
+    uint32_t node = compact_node_create(list, element, NONE);
+    if (node == NONE) // The arena is full
+    {
+        return false;
+    }
+    if (list->tail == NONE) // If the list was empty, it is also the head
+    {
+        list->head = node;
+    }
+    else
+    {
+        list->next[list->tail] = node; // Old tail points to it
+    }
+    list->tail = node;
+    list->size++;
+    return true;
+}
+
+bool compact_list_insert(
+    CompactList list,
+    void* element,
+    ListIndex position
+) // O(n)
+{
+    if (position < 0 || position > list->size) // Cannot insert at positions
+    {                                          // that do not exist
+        return false;
+    }
+    if (position == 0) // At the head
+    {
+        return compact_list_insert_first(list, element);
+    }
+    if (position == list->size) // At the tail
+    {
+        return compact_list_insert_last(list, element);
+    }
+    uint32_t previousNode = compact_node_at(list, position - 1);
+    uint32_t node =
+        compact_node_create(list, element, list->next[previousNode]);
+    if (node == NONE) // The arena is full
+    {
+        return false;
+    }
+    list->next[previousNode] = node; // Links it after the previous node
+    list->size++;
+    return true;
+}
+
+void* compact_list_remove_first(CompactList list) // O(1)
+{
+    if (list->head == NONE) // If the list is empty
+    {
+        return NULL;
+    }
+    uint32_t node = list->head;
+    void* element = compact_element(list, node);
+    list->head = list->next[node]; // Next node becomes the head
+    if (list->head == NONE)        // If it was the only one
+    {
+        list->tail = NONE;
+    }
+    compact_node_release(list, node);
+    list->size--;
+    return element;
+}
+
+void* compact_list_remove_last(CompactList list) // O(n)
+{
+    return compact_list_remove(list, list->size - 1);
+}
+
+void* compact_list_remove(CompactList list, ListIndex position) // O(n)
+{
+    if (position < 0 || position > list->size - 1) // Cannot remove positions
+    {                                              // that do not exist
+        return NULL;
+    }
+    if (position == 0) // At the head
+    {
+        return compact_list_remove_first(list);
+    }
+    uint32_t previousNode = compact_node_at(list, position - 1);
+    uint32_t node = list->next[previousNode];
+    void* element = compact_element(list, node);
+    list->next[previousNode] = list->next[node]; // Unlinks it
+    if (node == list->tail) // If it was the tail, the previous one is now
+    {
+        list->tail = previousNode;
+    }
+    compact_node_release(list, node);
+    list->size--;
+    return element;
+}
+
+void compact_list_for_each(
+    CompactList list,
+    void (*func)(void*, void*),
+    void* ctx
+) // O(n)
+{
+    for (uint32_t node = list->head; node != NONE; node = list->next[node])
+    {
+        func(compact_element(list, node), ctx);
+    }
+}
+
+void compact_list_to_array(CompactList list, void** out_array) // O(n)
+{
+    ListIndex i = 0;
+    for (uint32_t node = list->head; node != NONE; node = list->next[node])
+    {
+        out_array[i++] = compact_element(list, node);
+    }
+}
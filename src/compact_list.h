@@ -0,0 +1,206 @@
+#pragma once
+
+#include "list.h"
+
+#include <stdbool.h>
+
+/**
+ * @brief A list whose nodes live in one arena, linked by 32-bit indexes.
+ *
+ * Instead of one malloc per node, the nodes are slots of arrays owned by the
+ * list, and each node finds the next one by its index in them, a 32-bit
+ * integer instead of a pointer. A node takes 12 bytes (the element and the
+ * index) instead of the 16 of a Node plus the allocator's header, and only 8
+ * if the elements are stored as offsets (see compact_list_create_offsets).
+ * The arrays double when full, so compact_list_reserve avoids the copies and
+ * the unused slots when the final size is known.
+ *
+ * It holds at most 2^32 - 1 nodes, or LIST_INDEX_MAX if smaller (INT_MAX
+ * unless LIST_SIZE_64 is defined), and inserting into a full list fails
+ * (the insert functions return false). Removed nodes are reused by the next
+ * inserts; the arena only shrinks with compact_list_make_empty.
+ */
+typedef struct CompactList_* CompactList;
+
+/**
+ * @brief Creates a new list that stores pointers to its elements.
+ *
+ * @return CompactList The new list.
+ */
+CompactList compact_list_create();
+
+/**
+ * @brief Creates a new list that stores its elements as offsets from base.
+ *
+ * Every element must point into the 4 GB starting at base, e.g. into an array
+ * of records allocated by the caller. Each one is stored as its distance from
+ * base in 32 bits, and the functions that return elements return base plus
+ * that distance.
+ *
+ * @param base The start of the memory holding the elements.
+ * @return CompactList The new list.
+ */
+CompactList compact_list_create_offsets(void* base);
+
+/**
+ * @brief Destroys a list.
+ *
+ * Frees the arena, and the elements with free_element.
+ *
+ * @param list The compact list.
+ * @param free_element The function to free the elements, or NULL.
+ */
+void compact_list_destroy(CompactList list, void (*free_element)(void*));
+
+/**
+ * @brief Makes room for a number of nodes at once.
+ *
+ * Inserting up to that many elements in total afterwards never grows the
+ * arena again.
+ *
+ * @param list The compact list.
+ * @param count The number of nodes expected.
+ */
+void compact_list_reserve(CompactList list, ListIndex count);
+
+/**
+ * @brief Removes all elements from the list and releases its arena.
+ *
+ * @param list The compact list.
+ * @param free_element The function to free the elements, or NULL.
+ */
+void compact_list_make_empty(CompactList list, void (*free_element)(void*));
+
+/**
+ * @brief Returns true iff the list contains no elements.
+ *
+ * @param list The compact list.
+ * @return true iff the list contains no elements.
+ */
+bool compact_list_is_empty(CompactList list);
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @param list The compact list.
+ * @return ListIndex The number of elements in the list.
+ */
+ListIndex compact_list_size(CompactList list);
+
+/**
+ * @brief Returns the first element of the list.
+ *
+ * @param list The compact list.
+ * @return void* The first element, or NULL if the list is empty.
+ */
+void* compact_list_get_first(CompactList list);
+
+/**
+ * @brief Returns the last element of the list.
+ *
+ * @param list The compact list.
+ * @return void* The last element, or NULL if the list is empty.
+ */
+void* compact_list_get_last(CompactList list);
+
+/**
+ * @brief Returns the element at the specified position in the list.
+ *
+ * @param list The compact list.
+ * @param position The position of the element, from 0 to size - 1.
+ * @return void* The element, or NULL if the position does not exist.
+ */
+void* compact_list_get(CompactList list, ListIndex position);
+
+/**
+ * @brief Returns the position of the first occurrence of an element.
+ *
+ * @param list The compact list.
+ * @param equal The function to compare two elements.
+ * @param element The element to search for.
+ * @return ListIndex The position of the element, or -1 if it does not occur.
+ */
+ListIndex compact_list_find(
+    CompactList list,
+    bool (*equal)(void*, void*),
+    void* element
+);
+
+/**
+ * @brief Inserts an element at the beginning of the list.
+ *
+ * @param list The compact list.
+ * @param element The element to insert.
+ * @return true iff it was inserted, i.e. the list was not full.
+ */
+bool compact_list_insert_first(CompactList list, void* element);
+
+/**
+ * @brief Inserts an element at the end of the list.
+ *
+ * @param list The compact list.
+ * @param element The element to insert.
+ * @return true iff it was inserted, i.e. the list was not full.
+ */
+bool compact_list_insert_last(CompactList list, void* element);
+
+/**
+ * @brief Inserts an element at the specified position in the list.
+ *
+ * Nothing is inserted if the position is not from 0 to size.
+ *
+ * @param list The compact list.
+ * @param element The element to insert.
+ * @param position The position of the new element.
+ * @return true iff it was inserted, i.e. the position exists and the list
+ * was not full.
+ */
+bool compact_list_insert(CompactList list, void* element, ListIndex position);
+
+/**
+ * @brief Removes the first element of the list.
+ *
+ * @param list The compact list.
+ * @return void* The removed element, or NULL if the list is empty.
+ */
+void* compact_list_remove_first(CompactList list);
+
+/**
+ * @brief Removes the last element of the list.
+ *
+ * The nodes only link forward, so this walks the whole list.
+ *
+ * @param list The compact list.
+ * @return void* The removed element, or NULL if the list is empty.
+ */
+void* compact_list_remove_last(CompactList list);
+
+/**
+ * @brief Removes the element at the specified position in the list.
+ *
+ * @param list The compact list.
+ * @param position The position of the element, from 0 to size - 1.
+ * @return void* The removed element, or NULL if the position does not exist.
+ */
+void* compact_list_remove(CompactList list, ListIndex position);
+
+/**
+ * @brief Applies a function to each element of the list, in order.
+ *
+ * @param list The compact list.
+ * @param func The function to apply to each element, which also receives ctx.
+ * @param ctx The context passed to func, e.g. to accumulate a result.
+ */
+void compact_list_for_each(
+    CompactList list,
+    void (*func)(void*, void*),
+    void* ctx
+);
+
+/**
+ * @brief Copies the elements of the list to an array, in order.
+ *
+ * @param list The compact list.
+ * @param out_array The array, with room for size elements.
+ */
+void compact_list_to_array(CompactList list, void** out_array);
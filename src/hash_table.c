@@ -0,0 +1,200 @@
+#include "hash_table.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+typedef struct Slot_* Slot;
+
+struct Slot_
+{
+        void* element;
+        size_t hash;
+        ListIndex count; // Occurrences of the element (0 means a free slot)
+        ListIndex first; // Position of the first one (-1 if not recorded)
+}; // Struct = struct Slot_ ; Pointer = Slot
+
+struct HashTable_
+{
+        Slot slots;
+        int bits;       // Capacity is 2^bits slots
+        ListIndex used; // Slots holding an element
+        size_t (*hash)(void*);
+        bool (*equal)(void*, void*);
+}; // Struct = struct HashTable_ ; Pointer = HashTable
+
+#define INITIAL_BITS 4 // 16 slots
+
+static size_t slot_home(HashTable table, size_t hash) // O(1)
+{
+    unsigned long long mixed =
+        hash * 11400714819323198485ull; // Fibonacci hashing spreads hashes
+                                        // with poor low bits (e.g. addresses)
+    return (size_t)(mixed >> (64 - table->bits)); // Top bits pick the slot
+}
+
+static size_t slot_find(HashTable table, void* element, size_t hash) // O(1)
+{
+    size_t mask = ((size_t)1 << table->bits) - 1;
+    size_t i = slot_home(table, hash); // Starts at the element's home slot
+    while (table->slots[i].count != 0) // Linear probing until a free slot
+    {
+        if (table->slots[i].hash == hash &&
+            table->equal(table->slots[i].element, element)) // If found
+        {
+            return i;
+        }
+        i = (i + 1) & mask; // Wraps around
+    }
+    return i; // Free slot where the element would go
+}
+
+static void slots_allocate(HashTable table, int bits) // O(capacity)
+{
+    table->bits = bits;
+    table->slots = calloc(
+        (size_t)1 << bits, sizeof(struct Slot_)
+    ); // calloc sets every count to 0, i.e. every slot free
+}
+
+static void slots_grow(HashTable table, int bits) // O(capacity)
+{
+    size_t capacity = (size_t)1 << table->bits;
+    Slot old = table->slots;
+    slots_allocate(table, bits);
+    for (size_t j = 0; j < capacity; j++) // Moves every element over
+    {
+        if (old[j].count != 0)
+        {
+            table->slots[slot_find(table, old[j].element, old[j].hash)] =
+                old[j];
+        }
+    }
+    free(old);
+}
+
+HashTable sll_hash_table_create(
+    size_t (*hash)(void*),
+    bool (*equal)(void*, void*)
+) // O(1)
+{
+    HashTable table = malloc(sizeof(struct HashTable_));
+    table->hash = hash;
+    table->equal = equal;
+    table->used = 0;
+    slots_allocate(table, INITIAL_BITS);
+    return table;
+}
+
+void sll_hash_table_reserve(HashTable table, ListIndex count) // O(count)
+{
+    int bits = table->bits;
+    while (((size_t)1 << bits) < (size_t)count * 2) // At most half full
+    {
+        bits++;
+    }
+    if (bits > table->bits) // Never shrinks
+    {
+        slots_grow(table, bits);
+    }
+}
+
+void sll_hash_table_destroy(HashTable table) // O(1)
+{
+    free(table->slots);
+    free(table);
+}
+
+void sll_hash_table_clear(HashTable table) // O(capacity)
+{
+    free(table->slots);                  // Shrinks back to the initial size
+    slots_allocate(table, INITIAL_BITS); // instead of clearing every slot
+    table->used = 0;
+}
+
+ListIndex sll_hash_table_count(HashTable table, void* element) // O(1)
+{
+    return table->slots[slot_find(table, element, table->hash(element))]
+        .count; // A free slot has a count of 0
+}
+
+ListIndex sll_hash_table_add(HashTable table, void* element) // O(1) amortized
+{
+    size_t hash = table->hash(element);
+    size_t i = slot_find(table, element, hash);
+    if (table->slots[i].count != 0) // If already there, one more occurrence
+    {
+        return ++table->slots[i].count;
+    }
+    size_t capacity = (size_t)1 << table->bits;
+    if (((size_t)table->used + 1) * 2 > capacity) // Keeps the table at most
+    {                                             // half full, so probes
+        slots_grow(table, table->bits + 1);       // stay short
+        i = slot_find(table, element, hash);      // Slot in the new table
+    }
+    table->slots[i].element = element; // Takes the free slot
+    table->slots[i].hash = hash;
+    table->slots[i].count = 1;
+    table->slots[i].first = -1; // Recorded by the list, if it knows it
+    table->used++;
+    return 1;
+}
+
+ListIndex sll_hash_table_remove(HashTable table, void* element) // O(1)
+{
+    size_t i = slot_find(table, element, table->hash(element));
+    if (table->slots[i].count == 0) // Nothing to remove
+    {
+        return 0;
+    }
+    if (--table->slots[i].count > 0) // Other occurrences remain
+    {
+        return table->slots[i].count;
+    }
+    table->used--;
+    size_t mask = ((size_t)1 << table->bits) - 1;
+    size_t j = i;
+    while (true) // Shifts back the elements probed past the freed slot, so
+    {            // lookups never stop early at a hole
+        j = (j + 1) & mask;
+        if (table->slots[j].count == 0) // End of the probe run
+        {
+            break;
+        }
+        size_t home = slot_home(table, table->slots[j].hash);
+        if ((j > i && (home <= i || home > j)) ||
+            (j < i && home <= i && home > j)) // If its home is not between
+        {                                     // the hole and itself
+            table->slots[i] = table->slots[j]; // Moves it into the hole
+            table->slots[j].count = 0;         // which moves forward
+            i = j;
+        }
+    }
+    return 0;
+}
+
+ListIndex sll_hash_table_first(HashTable table, void* element) // O(1)
+{
+    Slot slot = &table->slots[slot_find(table, element, table->hash(element))];
+    return slot->count != 0 ? slot->first : -1;
+}
+
+void sll_hash_table_set_first(
+    HashTable table,
+    void* element,
+    ListIndex position
+) // O(1)
+{
+    Slot slot = &table->slots[slot_find(table, element, table->hash(element))];
+    if (slot->count != 0) // Only for elements in the table
+    {
+        slot->first = position;
+    }
+}
+
+void sll_hash_table_forget_firsts(HashTable table) // O(capacity)
+{
+    size_t capacity = (size_t)1 << table->bits;
+    for (size_t i = 0; i < capacity; i++)
+    {
+        table->slots[i].first = -1;
+    }
+}
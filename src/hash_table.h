@@ -0,0 +1,122 @@
+#pragma once
+
+#include "list.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief A hash table counting the occurrences of elements.
+ *
+ * Elements are compared with user functions, like the elements of a list.
+ * Used internally by the lists to index their elements, so each element can
+ * also have the position of its first occurrence in the list recorded.
+ */
+typedef struct HashTable_* HashTable;
+
+// Shared by the modules of the library, but not part of its API: the sll_
+// prefix keeps the names apart from the caller's, and a shared library does
+// not export them
+#ifdef __GNUC__
+#pragma GCC visibility push(hidden)
+#endif
+
+/**
+ * @brief Creates a new, empty hash table.
+ *
+ * @param hash The function to hash an element.
+ * @param equal The function to compare two elements.
+ * @return HashTable The new hash table.
+ */
+HashTable sll_hash_table_create(
+    size_t (*hash)(void*),
+    bool (*equal)(void*, void*)
+);
+
+/**
+ * @brief Makes room for a number of distinct elements at once.
+ *
+ * Adding that many elements afterwards never grows the table again.
+ *
+ * @param table The hash table.
+ * @param count The number of distinct elements expected.
+ */
+void sll_hash_table_reserve(HashTable table, ListIndex count);
+
+/**
+ * @brief Destroys a hash table. The elements themselves are not freed.
+ *
+ * @param table The hash table.
+ */
+void sll_hash_table_destroy(HashTable table);
+
+/**
+ * @brief Removes all elements from the hash table.
+ *
+ * @param table The hash table.
+ */
+void sll_hash_table_clear(HashTable table);
+
+/**
+ * @brief Returns the number of occurrences of an element.
+ *
+ * @param table The hash table.
+ * @param element The element to search for.
+ * @return ListIndex The number of occurrences of the element.
+ */
+ListIndex sll_hash_table_count(HashTable table, void* element);
+
+/**
+ * @brief Adds one occurrence of an element.
+ *
+ * @param table The hash table.
+ * @param element The element to add.
+ * @return ListIndex The number of occurrences of the element, including this
+ * one.
+ */
+ListIndex sll_hash_table_add(HashTable table, void* element);
+
+/**
+ * @brief Removes one occurrence of an element, if there is any.
+ *
+ * @param table The hash table.
+ * @param element The element to remove.
+ * @return ListIndex The number of occurrences of the element left.
+ */
+ListIndex sll_hash_table_remove(HashTable table, void* element);
+
+/**
+ * @brief Returns the recorded position of the first occurrence of an element.
+ *
+ * @param table The hash table.
+ * @param element The element to search for.
+ * @return ListIndex The position, or -1 if the element is absent or none was
+ * recorded.
+ */
+ListIndex sll_hash_table_first(HashTable table, void* element);
+
+/**
+ * @brief Records the position of the first occurrence of an element.
+ *
+ * Does nothing if the element is absent.
+ *
+ * @param table The hash table.
+ * @param element The element.
+ * @param position The position of its first occurrence.
+ */
+void sll_hash_table_set_first(
+    HashTable table,
+    void* element,
+    ListIndex position
+);
+
+/**
+ * @brief Forgets the recorded positions of every element.
+ *
+ * @param table The hash table.
+ */
+void sll_hash_table_forget_firsts(HashTable table);
+
+#ifdef __GNUC__
+#pragma GCC visibility pop
+#endif
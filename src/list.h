@@ -1,7 +1,11 @@
 #pragma once
 
+#include "list_config.h"
+
+#include <limits.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * @brief A list is a sequence of pointers to elements.
@@ -10,6 +14,50 @@
  */
 typedef struct List_* List;
 
+/**
+ * @brief The type of the sizes, positions and counts of a list.
+ *
+ * It is an int, unless LIST_SIZE_64 is defined (make LIST_SIZE_64=1), then it
+ * is a ptrdiff_t, so a list can hold more than INT_MAX elements on 64-bit
+ * platforms. Every file using the lists must be compiled with the same choice;
+ * the installed list_config.h defines it when the library was built with it.
+ * LIST_INDEX_MAX is its largest value.
+ */
+#ifdef LIST_SIZE_64
+typedef ptrdiff_t ListIndex;
+#define LIST_INDEX_MAX PTRDIFF_MAX
+#else
+typedef int ListIndex;
+#define LIST_INDEX_MAX INT_MAX
+#endif
+
+/**
+ * @brief An iterator with its own cursor, apart from the one of the list.
+ *
+ * Unlike list_iterator_start, any number of them can go over the same list at
+ * once, e.g. in nested loops or from several threads, as long as nobody
+ * changes the list meanwhile. list_get and list_find count as changes here,
+ * since they update caches kept in the list. It is meant to be declared as a
+ * local variable, so no memory is allocated; its fields are only used by the
+ * list functions.
+ *
+ * It does not know its position, so inserting or removing through it leaves
+ * the positional index of list_set_indexed to be rebuilt, in O(n), by the next
+ * positional operation: indexed lists are best edited with one pass of an
+ * iterator between positional calls, not by alternating the two.
+ */
+typedef struct ListIter_
+{
+        List list;
+        void* node;             // Node of the next element (NULL at the end)
+        int offset;             // Offset of the next element inside node
+        void* previous;         // Node before node (NULL at the head)
+        void* current;          // Node of the last element returned (or NULL)
+        int current_offset;     // Offset of that element inside current
+        void* current_previous; // Node before current
+        bool backwards;         // Moved by list_iter_previous last
+} ListIter; // Struct = struct ListIter_ ; Value = ListIter
+
 /**
  * @brief Creates a new list.
  *
@@ -17,6 +65,31 @@ typedef struct List_* List;
  */
 List list_create();
 
+/**
+ * @brief Creates a new list whose nodes are carved from chunks it owns.
+ *
+ * Each chunk holds chunk_nodes nodes and is allocated on demand. Removed nodes
+ * are kept for reuse instead of being freed, and list_make_empty and
+ * list_destroy release the nodes chunk by chunk instead of one by one.
+ * If chunk_nodes is not positive, the list behaves as one from list_create.
+ *
+ * @param chunk_nodes The number of nodes allocated at once.
+ * @return List The new list.
+ */
+List list_create_pooled(ListIndex chunk_nodes);
+
+/**
+ * @brief Creates a new list whose nodes also point to the node before them.
+ *
+ * Each node takes one more pointer, but list_remove_last and
+ * list_iter_previous take O(1) instead of walking from the head, e.g. for a
+ * stack that pushes and pops at the end. In the unrolled backend, every
+ * list already works this way, so this is the same as list_create.
+ *
+ * @return List The new list.
+ */
+List list_create_doubly();
+
 /**
  * @brief Destroys a list.
  *
@@ -27,6 +100,51 @@ List list_create();
  */
 void list_destroy(List list, void (*free_element)(void*));
 
+/**
+ * @brief Turns the positional index of a list on or off.
+ *
+ * An indexed list keeps a skip list over its nodes, so list_get, list_insert,
+ * list_remove and list_remove_last take expected O(log n) instead of O(n).
+ * list_insert_first and list_insert_last become O(log n) as well, so lists
+ * used only as queues are better left unindexed. Functions that remove
+ * several elements at once, and every insertion or removal through a
+ * ListIter, leave the index to be rebuilt, in O(n), by the next positional
+ * operation. The index takes about 11 bytes per element.
+ *
+ * The unrolled backend does not build the index; its positional operations
+ * already skip whole nodes.
+ *
+ * @param list The linked list.
+ * @param indexed true to build the index, false to drop it.
+ */
+void list_set_indexed(List list, bool indexed);
+
+/**
+ * @brief Attaches a hash index to the list, or drops it.
+ *
+ * The index counts the occurrences of each element and records the position
+ * of its first one, and is kept up to date by every function that inserts or
+ * removes elements. When list_find, list_count_all, list_remove_all or
+ * list_remove_duplicates are given this same equal function, they use the
+ * index: list_count_all takes O(1), list_remove_all and
+ * list_remove_duplicates return in O(1) when there is nothing to remove, and
+ * list_find takes O(1) for an element that does not occur. Inserting or
+ * removing at either end keeps the recorded positions up to date; other
+ * changes move them (as does removing the first element when it occurs
+ * again later), so the next list_find of an element that occurs records them
+ * again, in O(n) once, and takes O(1) from then on. list_splice into a
+ * hashed list takes O(m) to count the moved elements.
+ *
+ * @param list The linked list.
+ * @param hash The function to hash an element, or NULL to drop the index.
+ * @param equal The function to compare two elements, consistent with hash.
+ */
+void list_set_hash_index(
+    List list,
+    size_t (*hash)(void*),
+    bool (*equal)(void*, void*)
+);
+
 /**
  * @brief Returns true iff the list contains no elements.
  *
@@ -39,9 +157,9 @@ bool list_is_empty(List list);
  * @brief Returns the number of elements in the list.
  *
  * @param list The linked list.
- * @return int The number of elements in the list.
+ * @return ListIndex The number of elements in the list.
  */
-int list_size(List list);
+ListIndex list_size(List list);
 
 /**
  * @brief Returns the first element of the list.
@@ -63,26 +181,34 @@ void* list_get_last(List list);
  * @brief Returns the element at the specified position in the list.
  *
  * Range of valid positions: 0, ..., size()-1.
+ * The list remembers the node of the last call, so reading the positions in
+ * increasing order costs O(n) in total. Inserting or removing at or before
+ * that position makes the list forget it. Since this writes to the list (as
+ * may rebuilding a positional index), list_get is not safe to call from
+ * several threads at once, even if none of them changes the list; concurrent
+ * readers should use a ListIter each instead.
  *
  * @param list The linked list.
  * @param position The position of the element to return.
  * @return void* The element at the specified position in the list.
  */
-void* list_get(List list, int position);
+void* list_get(List list, ListIndex position);
 
 /**
  * @brief Returns the position in the list of the first occurrence of the
  * specified element.
  *
  * Returns -1 if the specified element does not occur in the list.
+ * With a hash index, this may record positions in it, so like list_get it is
+ * not safe to call from several threads at once.
  *
  * @param list The linked list.
  * @param equal The function to compare two elements.
  * @param element The element to search for.
- * @return int The position in the list of the first occurrence of the specified
- * element, or -1 if the specified element does not occur in the list.
+ * @return ListIndex The position in the list of the first occurrence of the
+ * specified element, or -1 if the specified element does not occur in the list.
  */
-int list_find(List list, bool (*equal)(void*, void*), void* element);
+ListIndex list_find(List list, bool (*equal)(void*, void*), void* element);
 
 /**
  * @brief Inserts the specified element at the first position in the list.
@@ -100,6 +226,36 @@ void list_insert_first(List list, void* element);
  */
 void list_insert_last(List list, void* element);
 
+/**
+ * @brief Inserts the elements of an array at the end of the list, in order.
+ *
+ * The nodes are linked in a single pass, and all of them come from a single
+ * allocation instead of one per element: the newest chunk of a pooled list if
+ * it has room, or otherwise a chunk of exactly the nodes needed, owned by the
+ * list. The existing nodes do not move, and a list that is not pooled stays
+ * so. The nodes of a chunk cannot be freed one by one, so a list holding any
+ * may keep the nodes it releases for reuse until list_make_empty or
+ * list_destroy.
+ *
+ * @param list The linked list.
+ * @param array The elements to insert.
+ * @param count The number of elements in the array.
+ */
+void list_insert_last_bulk(List list, void** array, ListIndex count);
+
+/**
+ * @brief Creates a new list with the elements of an array, in order.
+ *
+ * The inverse of list_to_array. The list is not pooled, but all of its nodes
+ * come from a single allocation of exactly the nodes needed, as in
+ * list_insert_last_bulk.
+ *
+ * @param array The elements of the new list.
+ * @param count The number of elements in the array.
+ * @return List The new list.
+ */
+List list_from_array(void** array, ListIndex count);
+
 /**
  * @brief Inserts the specified element at the specified position in the list.
  *
@@ -111,7 +267,7 @@ void list_insert_last(List list, void* element);
  * @param element The element to insert.
  * @param position The position at which to insert the specified element.
  */
-void list_insert(List list, void* element, int position);
+void list_insert(List list, void* element, ListIndex position);
 
 /**
  * @brief Removes and returns the element at the first position in the list.
@@ -124,6 +280,9 @@ void* list_remove_first(List list);
 /**
  * @brief Removes and returns the element at the last position in the list.
  *
+ * Takes O(n), walking from the head to the node before the last, unless the
+ * list was created by list_create_doubly.
+ *
  * @param list The linked list.
  * @return void* The element at the last position in the list.
  */
@@ -138,7 +297,7 @@ void* list_remove_last(List list);
  * @param position The position of the element to remove.
  * @return void* The element at the specified position in the list.
  */
-void* list_remove(List list, int position);
+void* list_remove(List list, ListIndex position);
 
 /**
  * @brief Removes all elements from the list.
@@ -162,9 +321,9 @@ void list_to_array(List list, void** out_array);
  * @param list The linked list.
  * @param equal The function to compare two elements.
  * @param element The element to search for.
- * @return int The number of occurrences on an element.
+ * @return ListIndex The number of occurrences on an element.
  */
-int list_count_all(List list, bool (*equal)(void*, void*), void* element);
+ListIndex list_count_all(List list, bool (*equal)(void*, void*), void* element);
 
 /**
  * @brief Removes all occurrences of an element, and returns the number of
@@ -174,9 +333,9 @@ int list_count_all(List list, bool (*equal)(void*, void*), void* element);
  * @param equal_element The function to compare two elements.
  * @param free_element The function to free the elements of the list.
  * @param element The element to search for.
- * @return int The number of occurrences on an element.
+ * @return ListIndex The number of occurrences on an element.
  */
-int list_remove_all(
+ListIndex list_remove_all(
     List list,
     bool (*equal_element)(void*, void*),
     void (*free_element)(void*),
@@ -192,15 +351,35 @@ int list_remove_all(
  * @param equal_element The function to compare two elements.
  * @param free_element The function to free the elements of the list.
  * @param element The element to search for.
- * @return int The number of occurrences on an element.
+ * @return ListIndex The number of occurrences on an element.
  */
-int list_remove_duplicates(
+ListIndex list_remove_duplicates(
     List list,
     bool (*equal_element)(void*, void*),
     void (*free_element)(void*),
     void* element
 );
 
+/**
+ * @brief Removes all duplicate occurrences of every element.
+ *
+ * Keeps only the first occurrence of each element, in order. Unlike calling
+ * list_remove_duplicates for each element, takes a single pass, remembering
+ * the elements seen so far in a hash set.
+ *
+ * @param list The linked list.
+ * @param hash The function to hash an element, consistent with equal_element.
+ * @param equal_element The function to compare two elements.
+ * @param free_element The function to free the elements of the list.
+ * @return ListIndex The number of elements removed.
+ */
+ListIndex list_unique(
+    List list,
+    size_t (*hash)(void*),
+    bool (*equal_element)(void*, void*),
+    void (*free_element)(void*)
+);
+
 /**
  * @brief Returns the result from the join of two lists.
  *
@@ -212,6 +391,33 @@ int list_remove_duplicates(
  */
 List list_join(List list1, List list2);
 
+/**
+ * @brief Moves all elements of the second list to the end of the first.
+ *
+ * Unlike list_join, no node is allocated: the nodes of list2 are linked after
+ * the tail of list1, in O(1), and list2 is left empty. list1 also takes over
+ * the chunks and released nodes of list2, even if only one of them is
+ * pooled. Only if list1 is doubly and list2 is not, the elements are copied
+ * instead, since the nodes of list2 have no room to point back.
+ *
+ * @param list1 The linked list that receives the elements.
+ * @param list2 The linked list that gives its elements.
+ */
+void list_splice(List list1, List list2);
+
+/**
+ * @brief Sorts the list in place.
+ *
+ * The sort is a stable merge sort: equal elements keep their relative order.
+ * No node is allocated; the nodes are only relinked.
+ *
+ * @param list The linked list.
+ * @param compare The function to compare two elements, returning a negative
+ * number, zero or a positive number if the first is smaller than, equal to
+ * or greater than the second (as for qsort).
+ */
+void list_sort(List list, int (*compare)(void*, void*));
+
 /**
  * @brief Outputs a formatted representation of the list.
  *
@@ -228,7 +434,11 @@ void list_print(List list, void (*print_element)(void* element));
  * @param end_idx The index of the last element to include.
  * @return List A list with the elements from start_idx to end_idx.
  */
-List list_get_sublist_between(List list, int start_idx, int end_idx);
+List list_get_sublist_between(
+    List list,
+    ListIndex start_idx,
+    ListIndex end_idx
+);
 
 /**
  * @brief Returns a list with the elements in the given array of unordered
@@ -242,7 +452,7 @@ List list_get_sublist_between(List list, int start_idx, int end_idx);
  * @return List A list with the elements in the given array of unordered
  * indexes.
  */
-List list_get_sublist(List list, int indexes[], int count);
+List list_get_sublist(List list, ListIndex indexes[], ListIndex count);
 
 /**
  * @brief Returns a list with the result of the execution of the function func
@@ -255,6 +465,33 @@ List list_get_sublist(List list, int indexes[], int count);
  */
 List list_map(List list, void* (*func)(void*));
 
+/**
+ * @brief Replaces each element of the list with the result of the execution
+ * of the function func with it as parameter.
+ *
+ * Unlike list_map, works in place, without allocating any node.
+ *
+ * @param list The linked list.
+ * @param func The function to apply to each element of the list.
+ * @param free_old The function to free the replaced elements, called unless
+ * func returned the element itself.
+ */
+void list_map_inplace(
+    List list,
+    void* (*func)(void*),
+    void (*free_old)(void*)
+);
+
+/**
+ * @brief Executes the function func with each element of the list, in order.
+ *
+ * @param list The linked list.
+ * @param func The function to apply to each element of the list, which also
+ * receives ctx.
+ * @param ctx The context passed to func, e.g. to accumulate a result.
+ */
+void list_for_each(List list, void (*func)(void*, void*), void* ctx);
+
 /**
  * @brief Returns a list with the elements that return true when applied with
  * the given function.
@@ -266,6 +503,79 @@ List list_map(List list, void* (*func)(void*));
  */
 List list_filter(List list, bool (*func)(void*));
 
+/**
+ * @brief Removes the elements that return false when applied with the given
+ * function.
+ *
+ * Unlike list_filter, works in place, in a single pass, without allocating a
+ * new list.
+ *
+ * @param list The linked list.
+ * @param func The boolean function to apply to each element of the list.
+ * @param free_element The function to free the removed elements.
+ * @return ListIndex The number of elements removed.
+ */
+ListIndex list_retain(
+    List list,
+    bool (*func)(void*),
+    void (*free_element)(void*)
+);
+
+/**
+ * @brief Combines the elements of the list into a single value.
+ *
+ * Starting with init, each element is folded into the accumulated value, in
+ * order.
+ *
+ * @param list The linked list.
+ * @param init The initial value.
+ * @param fold The function receiving the accumulated value, an element and
+ * ctx, and returning the new accumulated value.
+ * @param ctx The context passed to fold.
+ * @return void* The accumulated value.
+ */
+void* list_reduce(
+    List list,
+    void* init,
+    void* (*fold)(void*, void*, void*),
+    void* ctx
+);
+
+/**
+ * @brief Returns true iff some element returns true when applied with the
+ * given function.
+ *
+ * Stops at the first one.
+ *
+ * @param list The linked list.
+ * @param func The boolean function to apply to the elements of the list.
+ * @return bool true iff some element returns true.
+ */
+bool list_any(List list, bool (*func)(void*));
+
+/**
+ * @brief Returns true iff every element returns true when applied with the
+ * given function.
+ *
+ * Stops at the first one that does not. True for an empty list.
+ *
+ * @param list The linked list.
+ * @param func The boolean function to apply to the elements of the list.
+ * @return bool true iff every element returns true.
+ */
+bool list_all(List list, bool (*func)(void*));
+
+/**
+ * @brief Returns the position of the first element that returns true when
+ * applied with the given function.
+ *
+ * @param list The linked list.
+ * @param func The boolean function to apply to the elements of the list.
+ * @return ListIndex The position of the first such element, or -1 if there is
+ * none.
+ */
+ListIndex list_find_if(List list, bool (*func)(void*));
+
 /**
  * @brief Starts the iterator.
  *
@@ -287,4 +597,110 @@ bool list_iterator_has_next(List list);
  * @param list The linked list.
  * @return void* The next element in the iteration.
  */
-void* list_iterator_get_next(List list);
\ No newline at end of file
+void* list_iterator_get_next(List list);
+
+/**
+ * @brief Starts an iterator at the first element of the list.
+ *
+ * @param iter The iterator.
+ * @param list The linked list.
+ */
+void list_iter_init(ListIter* iter, List list);
+
+/**
+ * @brief Starts an iterator past the last element of the list, to go over it
+ * backwards with list_iter_previous.
+ *
+ * @param iter The iterator.
+ * @param list The linked list.
+ */
+void list_iter_init_last(ListIter* iter, List list);
+
+/**
+ * @brief Returns true iff the iterator has more elements.
+ *
+ * @param iter The iterator.
+ * @return bool true iff the iterator has more elements.
+ */
+bool list_iter_has_next(ListIter* iter);
+
+/**
+ * @brief Returns the next element of the iterator, and moves past it.
+ *
+ * @param iter The iterator.
+ * @return void* The next element, or NULL if there are no more.
+ */
+void* list_iter_next(ListIter* iter);
+
+/**
+ * @brief Returns the next element of the iterator, without moving past it.
+ *
+ * @param iter The iterator.
+ * @return void* The next element, or NULL if there are no more.
+ */
+void* list_iter_peek(ListIter* iter);
+
+/**
+ * @brief Returns true iff the iterator has elements before it.
+ *
+ * @param iter The iterator.
+ * @return bool true iff the iterator has elements before it.
+ */
+bool list_iter_has_previous(ListIter* iter);
+
+/**
+ * @brief Returns the element before the iterator, and moves back before it.
+ *
+ * Takes O(1) if the list was created by list_create_doubly, or always in the
+ * unrolled backend; otherwise it walks from the head, taking O(n).
+ * list_iter_next after it returns the same element again.
+ *
+ * @param iter The iterator.
+ * @return void* The previous element, or NULL if there are no more.
+ */
+void* list_iter_previous(ListIter* iter);
+
+/**
+ * @brief Removes the element last returned by the iterator.
+ *
+ * Takes O(1), unlike list_remove, since the iterator knows the node before it,
+ * but on an indexed list the next positional operation takes O(n).
+ * The iterator goes on with the element after it (or before it, if it was
+ * returned by list_iter_previous).
+ *
+ * @param iter The iterator.
+ * @return void* The element that was removed, or NULL if neither
+ * list_iter_next nor list_iter_previous was called yet or the element was
+ * already removed.
+ */
+void* list_iter_remove(ListIter* iter);
+
+/**
+ * @brief Inserts an element right before the one last returned by the
+ * iterator.
+ *
+ * Takes O(1), but see list_iter_remove on indexed lists. If there is no such
+ * element, because list_iter_next was not called yet or it was removed, or if
+ * the iterator is going backwards, inserts it where list_iter_insert_after
+ * would. The iterator does not return the inserted element.
+ *
+ * @param iter The iterator.
+ * @param element The element to insert.
+ */
+void list_iter_insert_before(ListIter* iter, void* element);
+
+/**
+ * @brief Inserts an element right after the one last returned by the
+ * iterator, i.e. right before the next one.
+ *
+ * Takes O(1), but see list_iter_remove on indexed lists. Elements inserted one
+ * after another keep their order. The iterator does not return the inserted
+ * element. If the iterator is going backwards, i.e. list_iter_previous was
+ * called last, it is inserted right before the element that returned, and the
+ * iterator moves back before it, so elements inserted one after another end up
+ * in reverse order.
+ *
+ * @param iter The iterator.
+ * @param element The element to insert.
+ */
+void list_iter_insert_after(ListIter* iter, void* element);
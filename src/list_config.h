@@ -0,0 +1,6 @@
+#pragma once
+
+// Build configuration of the lists, included by list.h. In the source tree it
+// is empty and the Makefile passes -DLIST_SIZE_64 itself; make install writes
+// its own copy recording the choice the library was built with, so programs
+// using the installed headers get the same ListIndex as the library
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "list.h"
+#include "list_layout.h"
+
+#include <stdbool.h>
+
+/*******************************************************************************
+ Inline versions of the O(1) accessors of list.h, for the default backend only
+ (the unrolled backend lays its lists out differently).
+
+ Including this header instead of list.h makes list_size, list_is_empty,
+ list_get_first, list_get_last, list_iterator_has_next and
+ list_iterator_get_next expand in place, instead of calling into
+ singly_linked_list.c, so the compiler can keep them in registers inside tight
+ loops. Their addresses, e.g. (list_size) or &list_size, still give the
+ out-of-line functions.
+ ******************************************************************************/
+
+/**
+ * @brief Same as list_size, expanded in place.
+ *
+ * @param list The linked list.
+ * @return ListIndex The number of elements in the list.
+ */
+static inline ListIndex list_size_inline(List list) { return list->size; }
+
+/**
+ * @brief Same as list_is_empty, expanded in place.
+ *
+ * @param list The linked list.
+ * @return bool true iff the list contains no elements.
+ */
+static inline bool list_is_empty_inline(List list) { return list->size == 0; }
+
+/**
+ * @brief Same as list_get_first, expanded in place.
+ *
+ * @param list The linked list.
+ * @return void* The first element in the list, or NULL if it is empty.
+ */
+static inline void* list_get_first_inline(List list)
+{
+    return list->size == 0 ? NULL : list->head->element;
+}
+
+/**
+ * @brief Same as list_get_last, expanded in place.
+ *
+ * @param list The linked list.
+ * @return void* The last element in the list, or NULL if it is empty.
+ */
+static inline void* list_get_last_inline(List list)
+{
+    return list->size == 0 ? NULL : list->tail->element;
+}
+
+/**
+ * @brief Same as list_iterator_has_next, expanded in place.
+ *
+ * @param list The linked list.
+ * @return bool true iff there are more elements to iterate.
+ */
+static inline bool list_iterator_has_next_inline(List list)
+{
+    return list->current != NULL;
+}
+
+/**
+ * @brief Same as list_iterator_get_next, expanded in place.
+ *
+ * @param list The linked list.
+ * @return void* The next element in the iteration.
+ */
+static inline void* list_iterator_get_next_inline(List list)
+{
+    void* element = list->current->element;
+    list->current = list->current->next;
+    return element;
+}
+
+#define list_size(list) list_size_inline(list)
+#define list_is_empty(list) list_is_empty_inline(list)
+#define list_get_first(list) list_get_first_inline(list)
+#define list_get_last(list) list_get_last_inline(list)
+#define list_iterator_has_next(list) list_iterator_has_next_inline(list)
+#define list_iterator_get_next(list) list_iterator_get_next_inline(list)
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "list.h"
+
+#include <stdbool.h>
+
+// Layout of the lists of the default backend (singly_linked_list.c), shared
+// with list_inline.h so both always agree. The unrolled backend lays its
+// lists out differently, so neither header applies to it.
+
+struct Node_
+{
+        void* element;
+        struct Node_* next;
+}; // Struct = struct Node_ ; Pointer = Node
+
+struct List_
+{
+        struct Node_* head;
+        struct Node_* tail;
+        ListIndex size;
+        struct Node_* current;
+        ListIndex chunk_nodes; // Nodes per chunk (0 means one per malloc)
+        ListIndex chunk_used;  // Nodes already carved from the newest chunk
+        struct Chunk_* chunks;    // Chunks owned by the list (newest first)
+        struct Chunk_* chunks_last; // Oldest chunk, so splices append in O(1)
+        struct Node_* free_nodes; // Released nodes, chained through next
+        struct Node_* free_last;  // Last of them (if free_nodes is not NULL)
+        ListIndex malloc_nodes;   // Nodes allocated one by one (not in chunks)
+        struct Skip_* index; // Sentinels of each index level (NULL if not
+                             // indexed)
+        int index_levels;        // Levels currently in use
+        bool index_stale;        // Index must be rebuilt before its next use
+        unsigned int index_seed; // State of the tower height generator
+        struct Node_* finger;      // Node returned by the last list_get
+        ListIndex finger_position; // Its position (finger may be NULL)
+        struct HashTable_* hash_index; // Occurrences of each element (or NULL)
+        bool (*hash_equal)(void*, void*); // Equality used by hash_index
+        bool hash_stale; // First positions in hash_index must be rebuilt
+        size_t hash_base; // Added to them, so changes at the head move them
+                          // all in O(1) (wrapping around)
+        bool doubly; // Nodes are DoublyNodes (from list_create_doubly)
+}; // Struct = struct List_ ; Pointer = List
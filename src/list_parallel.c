@@ -0,0 +1,241 @@
+#define _POSIX_C_SOURCE 200809L // For sysconf
+
+#include "list_parallel.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define CHUNKS_PER_THREAD 4 // More chunks than threads evens out the work
+                            // when func is slower on some elements
+#define MAX_THREADS 256     // Larger requests are clamped to it
+
+typedef struct Job_* Job;
+
+struct Job_
+{
+        void** elements; // Snapshot of the list
+        ListIndex size;
+        ListIndex chunk_size;
+        int chunks;
+        List* outputs; // One list per chunk
+        void* (*map)(void*);
+        bool (*filter)(void*); // Used when map is NULL
+        atomic_int next_chunk; // Next chunk nobody took yet
+}; // Struct = struct Job_ ; Pointer = Job
+
+static void* job_work(void* argument) // O(n / threads)
+{
+    Job job = argument;
+    int chunk;
+    while ((chunk = atomic_fetch_add(&job->next_chunk, 1)) <
+           job->chunks) // Takes chunks until there are none left
+    {
+        ListIndex start = chunk * job->chunk_size;
+        ListIndex end = start + job->chunk_size < job->size
+                            ? start + job->chunk_size
+                            : job->size;
+        List output = job->outputs[chunk]; // Only this thread touches it
+        for (ListIndex i = start; i < end; i++)
+        {
+            if (job->map != NULL)
+            {
+                list_insert_last(output, job->map(job->elements[i]));
+            }
+            else if (job->filter(job->elements[i]))
+            {
+                list_insert_last(output, job->elements[i]);
+            }
+        }
+    }
+    return NULL;
+}
+
+/*******************************************************************************
+ Thread pool. Started on the first parallel call and kept for the next ones,
+ so a call only wakes threads up instead of creating them. Only one call uses
+ it at a time; a concurrent (or nested) call runs on its own thread instead.
+ list_parallel_shutdown, or unloading the library, joins the threads.
+ ******************************************************************************/
+
+static pthread_mutex_t pool_run = PTHREAD_MUTEX_INITIALIZER; // Held by the
+                                                             // call using it
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_wake = PTHREAD_COND_INITIALIZER; // A new job
+static pthread_cond_t pool_done = PTHREAD_COND_INITIALIZER; // Helpers done
+static pthread_t pool_threads[MAX_THREADS]; // Started so far, to be joined
+static int pool_size = 0;           // Threads started so far
+static Job pool_job = NULL;         // Job of the current call
+static int pool_helpers = 0;        // Threads taking part in it
+static int pool_pending = 0;        // Of those, the ones still working
+static unsigned long pool_round = 0; // Incremented for every job
+static bool pool_stop = false;       // Set to make the threads return
+
+static void* pool_worker(void* argument) // Runs until the pool is stopped
+{
+    int id = (int)(size_t)argument;
+    unsigned long seen = 0;
+    pthread_mutex_lock(&pool_lock);
+    while (true)
+    {
+        while (pool_round == seen && !pool_stop) // Sleeps until the next job
+        {
+            pthread_cond_wait(&pool_wake, &pool_lock);
+        }
+        if (pool_stop)
+        {
+            break;
+        }
+        seen = pool_round;
+        if (id < pool_helpers) // Not every thread takes part in every job
+        {
+            Job job = pool_job;
+            pthread_mutex_unlock(&pool_lock);
+            job_work(job);
+            pthread_mutex_lock(&pool_lock);
+            if (--pool_pending == 0) // The last one wakes the caller
+            {
+                pthread_cond_signal(&pool_done);
+            }
+        }
+    }
+    pthread_mutex_unlock(&pool_lock);
+    return NULL;
+}
+
+static void pool_run_job(Job job, int helpers) // O(n / threads)
+{
+    while (pool_size < helpers) // Starts the missing threads, once
+    {
+        if (pthread_create(
+                &pool_threads[pool_size],
+                NULL,
+                pool_worker,
+                (void*)(size_t)pool_size
+            ) != 0) // If it cannot be started, the others take its chunks
+        {
+            break;
+        }
+        pool_size++;
+    }
+    helpers = helpers < pool_size ? helpers : pool_size;
+    pthread_mutex_lock(&pool_lock);
+    pool_job = job;
+    pool_helpers = helpers;
+    pool_pending = helpers;
+    pool_round++;
+    pthread_cond_broadcast(&pool_wake);
+    pthread_mutex_unlock(&pool_lock);
+    job_work(job); // The calling thread works too
+    pthread_mutex_lock(&pool_lock);
+    while (pool_pending > 0) // Waits for the helpers to finish their chunks
+    {
+        pthread_cond_wait(&pool_done, &pool_lock);
+    }
+    pool_job = NULL;  // So a thread started by a later call, with an id
+    pool_helpers = 0; // below this one's helpers, does not take it up
+    pthread_mutex_unlock(&pool_lock);
+}
+
+static void pool_stop_threads() // O(threads), with pool_run held
+{
+    pthread_mutex_lock(&pool_lock);
+    pool_stop = true;
+    pthread_cond_broadcast(&pool_wake);
+    pthread_mutex_unlock(&pool_lock);
+    for (int i = 0; i < pool_size; i++) // Waits for each one to return
+    {
+        pthread_join(pool_threads[i], NULL);
+    }
+    pool_size = 0;
+    pool_stop = false; // The next call starts the threads again
+}
+
+void list_parallel_shutdown() // O(threads)
+{
+    pthread_mutex_lock(&pool_run); // Waits for the running call, if any
+    pool_stop_threads();
+    pthread_mutex_unlock(&pool_run);
+}
+
+#ifdef __GNUC__
+__attribute__((destructor)) static void pool_unload() // O(threads)
+{
+    if (pthread_mutex_trylock(&pool_run) == 0) // At exit, a call still running
+    {                                          // on another thread keeps them
+        pool_stop_threads();
+        pthread_mutex_unlock(&pool_run);
+    }
+}
+#endif
+
+/*******************************************************************************
+ Parallel operations.
+ ******************************************************************************/
+
+List list_run_parallel(
+    List list,
+    void* (*map)(void*),
+    bool (*filter)(void*),
+    int threads
+) // O(n / threads)
+{
+    if (threads <= 0) // One per processor
+    {
+        long processors = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = processors > 0 ? (int)processors : 1;
+    }
+    threads = threads < MAX_THREADS ? threads : MAX_THREADS;
+    struct Job_ job;
+    job.size = list_size(list);
+    job.chunks = threads * CHUNKS_PER_THREAD < job.size
+                     ? threads * CHUNKS_PER_THREAD
+                     : job.size;
+    job.chunks = job.chunks > 0 ? job.chunks : 1;
+    job.chunk_size = (job.size + job.chunks - 1) / job.chunks;
+    job.chunks = job.size > 0 ? (job.size + job.chunk_size - 1) / job.chunk_size
+                              : 1; // Rounding up may leave chunks unused
+    job.elements = malloc((job.size > 0 ? job.size : 1) * sizeof(void*));
+    list_to_array(list, job.elements); // Threads read the snapshot, not the
+                                       // nodes, so they can split it freely
+    job.outputs = malloc(job.chunks * sizeof(List));
+    for (int i = 0; i < job.chunks; i++)
+    {
+        job.outputs[i] = list_create();
+    }
+    job.map = map;
+    job.filter = filter;
+    atomic_init(&job.next_chunk, 0);
+
+    int helpers = (threads < job.chunks ? threads : job.chunks) - 1;
+    if (helpers > 0 && pthread_mutex_trylock(&pool_run) == 0)
+    {
+        pool_run_job(&job, helpers);
+        pthread_mutex_unlock(&pool_run);
+    }
+    else // Nothing to share, or the pool is busy with another call
+    {
+        job_work(&job);
+    }
+
+    List result = job.outputs[0];
+    for (int i = 1; i < job.chunks; i++) // Links the chunks in order
+    {
+        list_splice(result, job.outputs[i]); // O(1), no node is copied
+        list_destroy(job.outputs[i], NULL);
+    }
+    free(job.outputs);
+    free(job.elements);
+    return result;
+}
+
+List list_map_parallel(List list, void* (*func)(void*), int threads) // O(n)
+{
+    return list_run_parallel(list, func, NULL, threads);
+}
+
+List list_filter_parallel(List list, bool (*func)(void*), int threads) // O(n)
+{
+    return list_run_parallel(list, NULL, func, threads);
+}
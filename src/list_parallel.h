@@ -0,0 +1,53 @@
+#pragma once
+
+#include "list.h"
+
+#include <stdbool.h>
+
+/**
+ * @brief Returns a list with the result of the execution of the function func
+ * with each element of the list as parameter, using several threads.
+ *
+ * Same result as list_map, in the same order. The elements are split in
+ * chunks, each mapped by one thread into its own list, and the lists are then
+ * linked together in O(1) each. func is called concurrently, so it must be
+ * thread-safe. The list must not be changed while this runs. The threads
+ * are started by the first call and kept for the next ones, until
+ * list_parallel_shutdown; a call made while another one is running (e.g. from
+ * func) runs on the calling thread.
+ *
+ * @param list The linked list.
+ * @param func The function to apply to each element of the list.
+ * @param threads The number of threads, or 0 for one per processor.
+ * At most 256 are used.
+ * @return List A list with the result of the execution of the function func
+ * with each element of the list as parameter.
+ */
+List list_map_parallel(List list, void* (*func)(void*), int threads);
+
+/**
+ * @brief Returns a list with the elements that return true when applied with
+ * the given function, using several threads.
+ *
+ * Same result as list_filter, in the same order. Works like
+ * list_map_parallel, and func must also be thread-safe.
+ *
+ * @param list The linked list.
+ * @param func The boolean function to apply to each element of the list.
+ * @param threads The number of threads, or 0 for one per processor.
+ * @return List A list with the elements that return true when applied with the
+ * given function.
+ */
+List list_filter_parallel(List list, bool (*func)(void*), int threads);
+
+/**
+ * @brief Stops the threads kept by the parallel functions.
+ *
+ * Waits for a parallel call running on another thread to finish, then wakes
+ * the threads up, waits for them to return and releases them. A later
+ * parallel call starts them again. It is also done when the library is
+ * unloaded (e.g. by dlclose) or the program exits, so it is only needed to
+ * release the threads earlier. It must not be called from the function
+ * passed to a parallel call.
+ */
+void list_parallel_shutdown();
@@ -0,0 +1,340 @@
+#include "list_queue.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+typedef struct QueueNode_* QueueNode;
+
+struct QueueNode_
+{
+        void* element;
+        _Atomic(QueueNode) next;
+}; // Struct = struct QueueNode_ ; Pointer = QueueNode
+
+struct ListQueue_
+{
+        _Alignas(64) _Atomic(QueueNode) head; // Placeholder node, the first
+                                              // element is in its next
+        _Atomic(ListIndex) removed; // Next to head, only touched by consumers
+        _Alignas(64) _Atomic(QueueNode) tail; // Own cache line, so producers
+                                              // and consumers do not share it
+        _Atomic(ListIndex) inserted; // Next to tail, only touched by producers
+}; // Struct = struct ListQueue_ ; Pointer = ListQueue
+
+/*******************************************************************************
+ Hazard pointers. Before reading a node, a thread publishes its address in one
+ of its hazard slots, and checks the node is still in the queue. A removed
+ node is retired instead of freed, and only freed once no slot points to it.
+ ******************************************************************************/
+
+#define HAZARDS 2        // Slots per thread: a remove reads two nodes
+#define RETIRED_MIN 64   // Retired nodes kept before looking for free ones
+
+typedef struct HazardRecord_* HazardRecord;
+
+struct HazardRecord_
+{
+        _Atomic(void*) hazards[HAZARDS];
+        atomic_bool active;  // Owned by a running thread
+        HazardRecord next;   // Records are never removed, so next never changes
+        QueueNode* retired;  // Removed nodes waiting to be freed
+        int retired_count;
+        int retired_capacity;
+}; // Struct = struct HazardRecord_ ; Pointer = HazardRecord
+
+static _Atomic(HazardRecord) hazard_records = NULL; // Shared by all queues
+static atomic_int hazard_record_count = 0;
+static _Thread_local HazardRecord hazard_own = NULL; // This thread's record
+static pthread_key_t hazard_key; // Releases the record when the thread exits
+static pthread_once_t hazard_key_once = PTHREAD_ONCE_INIT;
+
+static QueueNode hazard_protect(
+    HazardRecord own,
+    int slot,
+    _Atomic(QueueNode)* source
+) // O(1), retried while source changes
+{
+    QueueNode node = atomic_load(source);
+    while (true) // The node is safe once published while source still has it
+    {
+        atomic_store(&own->hazards[slot], node);
+        QueueNode again = atomic_load(source);
+        if (again == node)
+        {
+            return node;
+        }
+        node = again;
+    }
+}
+
+static void hazard_clear(HazardRecord own) // O(1)
+{
+    for (int i = 0; i < HAZARDS; i++)
+    {
+        atomic_store(&own->hazards[i], NULL);
+    }
+}
+
+static bool hazard_is_protected(
+    void** hazards,
+    int count,
+    void* node
+) // O(count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (hazards[i] == node)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void hazard_scan(HazardRecord own) // O(retired * threads)
+{
+    HazardRecord first = atomic_load(&hazard_records); // Records added later
+    int capacity = 0; // belong to threads that cannot reach retired nodes
+    for (HazardRecord record = first; record != NULL; record = record->next)
+    {
+        capacity += HAZARDS;
+    }
+    void** hazards = malloc(capacity * sizeof(void*));
+    int count = 0;
+    for (HazardRecord record = first; record != NULL;
+         record = record->next) // Collects every published pointer
+    {
+        for (int i = 0; i < HAZARDS; i++)
+        {
+            void* hazard = atomic_load(&record->hazards[i]);
+            if (hazard != NULL)
+            {
+                hazards[count++] = hazard;
+            }
+        }
+    }
+    int kept = 0;
+    for (int i = 0; i < own->retired_count; i++) // Frees the ones nobody reads
+    {
+        if (hazard_is_protected(hazards, count, own->retired[i]))
+        {
+            own->retired[kept++] = own->retired[i];
+        }
+        else
+        {
+            free(own->retired[i]);
+        }
+    }
+    own->retired_count = kept;
+    free(hazards);
+}
+
+static void hazard_retire(HazardRecord own, QueueNode node) // O(1) amortized
+{
+    if (own->retired_count == own->retired_capacity) // Grows the array
+    {
+        own->retired_capacity =
+            own->retired_capacity > 0 ? own->retired_capacity * 2 : RETIRED_MIN;
+        own->retired =
+            realloc(own->retired, own->retired_capacity * sizeof(QueueNode));
+    }
+    own->retired[own->retired_count++] = node;
+    int threshold = 2 * HAZARDS * atomic_load(&hazard_record_count);
+    if (own->retired_count >= RETIRED_MIN &&
+        own->retired_count >= threshold) // Scans rarely, so each scan frees
+    {                                    // at least half of them
+        hazard_scan(own);
+    }
+}
+
+static void hazard_release(void* record) // O(retired * threads)
+{
+    HazardRecord own = record;
+    hazard_clear(own);
+    if (own->retired_count > 0) // Frees what nobody reads anymore, and the
+    {                           // rest goes to the next thread that takes it
+        hazard_scan(own);
+    }
+    atomic_store(&own->active, false);
+}
+
+static void hazard_key_create()
+{
+    pthread_key_create(&hazard_key, hazard_release);
+}
+
+static HazardRecord hazard_record() // O(threads) the first time, then O(1)
+{
+    if (hazard_own != NULL)
+    {
+        return hazard_own;
+    }
+    HazardRecord record = atomic_load(&hazard_records);
+    for (; record != NULL; record = record->next) // Reuses a released one
+    {
+        bool released = false;
+        if (atomic_compare_exchange_strong(&record->active, &released, true))
+        {
+            break;
+        }
+    }
+    if (record == NULL) // None free, adds a new one
+    {
+        record = malloc(sizeof(struct HazardRecord_));
+        for (int i = 0; i < HAZARDS; i++)
+        {
+            atomic_init(&record->hazards[i], NULL);
+        }
+        atomic_init(&record->active, true);
+        record->retired = NULL;
+        record->retired_count = 0;
+        record->retired_capacity = 0;
+        record->next = atomic_load(&hazard_records);
+        while (!atomic_compare_exchange_weak(
+            &hazard_records, &record->next, record
+        )) // Pushes it on the front
+        {
+        }
+        atomic_fetch_add(&hazard_record_count, 1);
+    }
+    pthread_once(&hazard_key_once, hazard_key_create);
+    pthread_setspecific(hazard_key, record);
+    hazard_own = record;
+    return record;
+}
+
+static void hazard_scan_released(HazardRecord own) // O(retired * threads)
+{
+    if (own != NULL && own->retired_count > 0) // This thread's retired nodes
+    {
+        hazard_scan(own);
+    }
+    for (HazardRecord record = atomic_load(&hazard_records); record != NULL;
+         record = record->next) // And those left by threads that exited,
+    {                           // taking each record while scanning it
+        bool released = false;
+        if (atomic_compare_exchange_strong(&record->active, &released, true))
+        {
+            if (record->retired_count > 0)
+            {
+                hazard_scan(record);
+            }
+            atomic_store(&record->active, false);
+        }
+    }
+}
+
+/*******************************************************************************
+ Queue.
+ ******************************************************************************/
+
+ListQueue list_queue_create() // O(1)
+{
+    ListQueue queue = aligned_alloc(
+        _Alignof(struct ListQueue_), sizeof(struct ListQueue_)
+    ); // Keeps head and tail on their own cache lines
+    QueueNode placeholder = malloc(sizeof(struct QueueNode_));
+    placeholder->element = NULL;
+    atomic_init(&placeholder->next, NULL);
+    atomic_init(&queue->head, placeholder); // Head and tail are never NULL
+    atomic_init(&queue->tail, placeholder);
+    atomic_init(&queue->inserted, 0);
+    atomic_init(&queue->removed, 0);
+    return queue;
+}
+
+void list_queue_destroy(ListQueue queue, void (*free_element)(void*)) // O(n)
+{
+    QueueNode node = atomic_load(&queue->head);
+    bool placeholder = true; // The head holds no element
+    while (node != NULL)
+    {
+        QueueNode next = atomic_load(&node->next);
+        if (!placeholder && free_element != NULL)
+        {
+            free_element(node->element);
+        }
+        free(node);
+        node = next;
+        placeholder = false;
+    }
+    free(queue);
+    hazard_scan_released(hazard_own); // Nodes retired by running threads are
+}                                     // freed by their next scan
+
+bool list_queue_is_empty(ListQueue queue) // O(1)
+{
+    return list_queue_size(queue) == 0;
+}
+
+ListIndex list_queue_size(ListQueue queue) // O(1)
+{
+    ListIndex removed = atomic_load(&queue->removed); // Read first, so it
+    return atomic_load(&queue->inserted) - removed;   // never exceeds inserted
+}
+
+void list_queue_insert_last(ListQueue queue, void* element) // O(1)
+{
+    QueueNode node = malloc(sizeof(struct QueueNode_));
+    node->element = element;
+    atomic_init(&node->next, NULL);
+    atomic_fetch_add(&queue->inserted, 1); // Before anyone can remove it
+    HazardRecord own = hazard_record();
+    while (true)
+    {
+        QueueNode tail = hazard_protect(own, 0, &queue->tail);
+        QueueNode next = atomic_load(&tail->next);
+        if (next != NULL) // Another insert linked its node but has not moved
+        {                 // the tail yet, so this one helps
+            atomic_compare_exchange_strong(&queue->tail, &tail, next);
+            continue;
+        }
+        if (atomic_compare_exchange_strong(
+                &tail->next, &next, node
+            )) // Links the node after the tail
+        {
+            atomic_compare_exchange_strong(
+                &queue->tail, &tail, node
+            ); // If it fails, someone else already moved the tail
+            break;
+        }
+    }
+    hazard_clear(own);
+}
+
+void* list_queue_remove_first(ListQueue queue) // O(1)
+{
+    HazardRecord own = hazard_record();
+    QueueNode head;
+    void* element;
+    while (true)
+    {
+        head = hazard_protect(own, 0, &queue->head);
+        QueueNode next = hazard_protect(own, 1, &head->next);
+        if (atomic_load(&queue->head) != head) // next may be gone already
+        {
+            continue;
+        }
+        if (next == NULL) // Only the placeholder, so the queue is empty
+        {
+            hazard_clear(own);
+            return NULL;
+        }
+        QueueNode tail = atomic_load(&queue->tail);
+        if (head == tail) // The tail lags behind, so this one helps
+        {
+            atomic_compare_exchange_strong(&queue->tail, &tail, next);
+            continue;
+        }
+        element = next->element; // Read before next becomes the placeholder
+        if (atomic_compare_exchange_strong(&queue->head, &head, next))
+        {
+            break;
+        }
+    }
+    hazard_clear(own);
+    atomic_fetch_add(&queue->removed, 1);
+    hazard_retire(own, head); // The old placeholder leaves the queue
+    return element;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "list.h"
+
+#include <stdbool.h>
+
+/**
+ * @brief A queue of pointers to elements, safe to use from several threads.
+ *
+ * It is a lock-free linked list (Michael and Scott's queue): elements are
+ * inserted at the end and removed from the front, like list_insert_last and
+ * list_remove_first, without any lock, so producers and consumers do not wait
+ * for each other. Removed nodes are only freed once no thread can still be
+ * reading them (hazard pointers).
+ */
+typedef struct ListQueue_* ListQueue;
+
+/**
+ * @brief Creates a new, empty queue.
+ *
+ * @return ListQueue The new queue.
+ */
+ListQueue list_queue_create();
+
+/**
+ * @brief Destroys a queue.
+ *
+ * No other thread may use the queue during or after this call.
+ *
+ * @param queue The queue.
+ * @param free_element The function to free the elements left in the queue.
+ */
+void list_queue_destroy(ListQueue queue, void (*free_element)(void*));
+
+/**
+ * @brief Returns true iff the queue contains no elements.
+ *
+ * Other threads may change the queue right after, so this is only a hint
+ * while they run.
+ *
+ * @param queue The queue.
+ * @return true iff the queue contains no elements.
+ */
+bool list_queue_is_empty(ListQueue queue);
+
+/**
+ * @brief Returns the number of elements in the queue.
+ *
+ * Other threads may change the queue right after, so this is only a hint
+ * while they run.
+ *
+ * @param queue The queue.
+ * @return ListIndex The number of elements in the queue.
+ */
+ListIndex list_queue_size(ListQueue queue);
+
+/**
+ * @brief Inserts an element at the end of the queue.
+ *
+ * @param queue The queue.
+ * @param element The element to insert.
+ */
+void list_queue_insert_last(ListQueue queue, void* element);
+
+/**
+ * @brief Removes the first element of the queue.
+ *
+ * @param queue The queue.
+ * @return void* The element that was removed, or NULL if the queue is empty.
+ */
+void* list_queue_remove_first(ListQueue queue);
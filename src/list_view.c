@@ -0,0 +1,120 @@
+#include "list_view.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+typedef struct Stage_* Stage;
+
+struct Stage_
+{
+        void* (*map)(void*);
+        bool (*filter)(void*); // Used when map is NULL
+}; // Struct = struct Stage_ ; Pointer = Stage
+
+struct ListView_
+{
+        List list;
+        Stage stages; // In the order they were added
+        int count;
+        int capacity;
+}; // Struct = struct ListView_ ; Pointer = ListView
+
+ListView list_view(List list) // O(1)
+{
+    ListView view = malloc(sizeof(struct ListView_));
+    view->list = list;
+    view->stages = NULL; // No stages yet
+    view->count = 0;
+    view->capacity = 0;
+    return view;
+}
+
+void view_destroy(ListView view) // O(1)
+{
+    free(view->stages);
+    free(view);
+}
+
+static void view_add(
+    ListView view,
+    void* (*map)(void*),
+    bool (*filter)(void*)
+) // O(1)
+{
+    if (view->count == view->capacity) // Grows the array
+    {
+        view->capacity = view->capacity > 0 ? view->capacity * 2 : 4;
+        view->stages =
+            realloc(view->stages, view->capacity * sizeof(struct Stage_));
+    }
+    view->stages[view->count].map = map;
+    view->stages[view->count].filter = filter;
+    view->count++;
+}
+
+void view_map(ListView view, void* (*func)(void*)) // O(1)
+{
+    view_add(view, func, NULL);
+}
+
+void view_filter(ListView view, bool (*func)(void*)) // O(1)
+{
+    view_add(view, NULL, func);
+}
+
+static bool view_next(ListView view, ListIter* iter, void** out) // O(stages)
+{
+    while (list_iter_has_next(iter)) // Until an element passes every stage
+    {
+        void* element = list_iter_next(iter);
+        bool kept = true;
+        for (int i = 0; i < view->count && kept; i++)
+        {
+            Stage stage = &view->stages[i];
+            if (stage->map != NULL)
+            {
+                element = stage->map(element);
+            }
+            else
+            {
+                kept = stage->filter(element); // Later stages are skipped
+            }
+        }
+        if (kept)
+        {
+            *out = element;
+            return true;
+        }
+    }
+    return false;
+}
+
+void* view_reduce(
+    ListView view,
+    void* init,
+    void* (*fold)(void*, void*, void*),
+    void* ctx
+) // O(n * stages)
+{
+    ListIter iter;
+    list_iter_init(&iter, view->list);
+    void* accumulated = init;
+    void* element;
+    while (view_next(view, &iter, &element)) // One traversal for all stages
+    {
+        accumulated = fold(accumulated, element, ctx);
+    }
+    return accumulated;
+}
+
+List view_to_list(ListView view) // O(n * stages)
+{
+    List newlist = list_create();
+    ListIter iter;
+    list_iter_init(&iter, view->list);
+    void* element;
+    while (view_next(view, &iter, &element)) // One traversal for all stages
+    {
+        list_insert_last(newlist, element);
+    }
+    return newlist;
+}
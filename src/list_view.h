@@ -0,0 +1,77 @@
+#pragma once
+
+#include "list.h"
+
+#include <stdbool.h>
+
+/**
+ * @brief A lazy sequence of map and filter stages over a list.
+ *
+ * Unlike list_map and list_filter, adding a stage does not go over the list.
+ * The stages only run when a result is asked for (view_reduce, view_to_list),
+ * and then each element goes through all of them before the next one, in a
+ * single traversal, so no list is created in between. The list must not be
+ * changed while a result is computed.
+ */
+typedef struct ListView_* ListView;
+
+/**
+ * @brief Creates a view over the list, with no stages yet.
+ *
+ * @param list The linked list.
+ * @return ListView The new view.
+ */
+ListView list_view(List list);
+
+/**
+ * @brief Destroys a view. The list is not changed.
+ *
+ * @param view The view.
+ */
+void view_destroy(ListView view);
+
+/**
+ * @brief Adds a stage replacing each element with the result of the execution
+ * of the function func with it as parameter.
+ *
+ * @param view The view.
+ * @param func The function to apply to each element.
+ */
+void view_map(ListView view, void* (*func)(void*));
+
+/**
+ * @brief Adds a stage keeping only the elements that return true when applied
+ * with the given function.
+ *
+ * @param view The view.
+ * @param func The boolean function to apply to each element.
+ */
+void view_filter(ListView view, bool (*func)(void*));
+
+/**
+ * @brief Combines the elements coming out of the view into a single value.
+ *
+ * Starting with init, each element is folded into the accumulated value, in
+ * order, as in list_reduce.
+ *
+ * @param view The view.
+ * @param init The initial value.
+ * @param fold The function receiving the accumulated value, an element and
+ * ctx, and returning the new accumulated value.
+ * @param ctx The context passed to fold.
+ * @return void* The accumulated value.
+ */
+void* view_reduce(
+    ListView view,
+    void* init,
+    void* (*fold)(void*, void*, void*),
+    void* ctx
+);
+
+/**
+ * @brief Returns a list with the elements coming out of the view.
+ *
+ * @param view The view.
+ * @return List A list with the elements coming out of the view.
+ */
+List view_to_list(ListView view);
@@ -0,0 +1,191 @@
+#include "persistent_list.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+// A version is a pointer to its first node, and each node knows the size of
+// the list starting at it, so sharing a suffix is sharing a pointer
+
+struct PersistentList_
+{
+        void* element;
+        PersistentList next; // Holds one reference to it
+        ListIndex size;      // Elements from this node to the end
+        int references;      // Versions and nodes pointing to this node
+}; // Struct = struct PersistentList_ ; Pointer = PersistentList
+
+static PersistentList persistent_node_create(
+    void* element,
+    PersistentList next
+) // O(1), takes over a reference to next
+{
+    PersistentList node = malloc(sizeof(struct PersistentList_));
+    node->element = element;
+    node->next = next;
+    node->size = persistent_list_size(next) + 1;
+    node->references = 1; // The caller's
+    return node;
+}
+
+PersistentList persistent_list_acquire(PersistentList list) // O(1)
+{
+    if (list != NULL) // The empty list is not counted
+    {
+        list->references++;
+    }
+    return list;
+}
+
+void persistent_list_release(PersistentList list) // O(freed nodes)
+{
+    while (list != NULL && --list->references == 0) // A loop, not recursion,
+    {                                               // so long lists do not
+        PersistentList next = list->next;           // overflow the stack
+        free(list);
+        list = next; // Releases the reference it held
+    }
+}
+
+ListIndex persistent_list_size(PersistentList list) // O(1)
+{
+    return list != NULL ? list->size : 0;
+}
+
+void* persistent_list_first(PersistentList list) // O(1)
+{
+    return list != NULL ? list->element : NULL;
+}
+
+void* persistent_list_get(PersistentList list, ListIndex position) // O(n)
+{
+    if (position < 0 || position >= persistent_list_size(list))
+    {
+        return NULL;
+    }
+    for (ListIndex i = 0; i < position; i++)
+    {
+        list = list->next;
+    }
+    return list->element;
+}
+
+PersistentList persistent_list_prepend(
+    PersistentList list,
+    void* element
+) // O(1)
+{
+    return persistent_node_create(element, persistent_list_acquire(list));
+}
+
+PersistentList persistent_list_rest(PersistentList list) // O(1)
+{
+    return list != NULL ? persistent_list_acquire(list->next) : NULL;
+}
+
+PersistentList persistent_list_suffix(
+    PersistentList list,
+    ListIndex start
+) // O(n)
+{
+    if (start < 0)
+    {
+        start = 0;
+    }
+    for (ListIndex i = 0; list != NULL && i < start; i++)
+    {
+        list = list->next;
+    }
+    return persistent_list_acquire(list); // Shared, not copied
+}
+
+PersistentList persistent_list_copy_before(
+    PersistentList list,
+    ListIndex position,
+    PersistentList rest
+) // O(position), takes over a reference to rest
+{
+    if (position == 0) // Nothing before it
+    {
+        return rest;
+    }
+    void** elements = malloc(position * sizeof(void*)); // The nodes are
+    for (ListIndex i = 0; i < position; i++)            // rebuilt from the
+    {                                                   // back, since each
+        elements[i] = list->element;                    // points forward
+        list = list->next;
+    }
+    for (ListIndex i = position - 1; i >= 0; i--)
+    {
+        rest = persistent_node_create(elements[i], rest);
+    }
+    free(elements);
+    return rest;
+}
+
+PersistentList persistent_list_insert(
+    PersistentList list,
+    void* element,
+    ListIndex position
+) // O(n)
+{
+    if (position < 0 || position > persistent_list_size(list))
+    {
+        return persistent_list_acquire(list);
+    }
+    PersistentList suffix = persistent_list_suffix(list, position);
+    return persistent_list_copy_before(
+        list, position, persistent_node_create(element, suffix)
+    );
+}
+
+PersistentList persistent_list_remove(
+    PersistentList list,
+    ListIndex position
+) // O(n)
+{
+    if (position < 0 || position >= persistent_list_size(list))
+    {
+        return persistent_list_acquire(list);
+    }
+    PersistentList suffix = persistent_list_suffix(list, position + 1);
+    return persistent_list_copy_before(list, position, suffix);
+}
+
+PersistentList persistent_list_set(
+    PersistentList list,
+    void* element,
+    ListIndex position
+) // O(n)
+{
+    if (position < 0 || position >= persistent_list_size(list))
+    {
+        return persistent_list_acquire(list);
+    }
+    PersistentList suffix = persistent_list_suffix(list, position + 1);
+    return persistent_list_copy_before(
+        list, position, persistent_node_create(element, suffix)
+    );
+}
+
+PersistentList persistent_list_from_list(List list) // O(n)
+{
+    ListIndex size = list_size(list);
+    void** elements = malloc((size > 0 ? size : 1) * sizeof(void*));
+    list_to_array(list, elements);
+    PersistentList result = NULL;
+    for (ListIndex i = size - 1; i >= 0; i--) // From the back, since each node
+    {                                   // points forward
+        result = persistent_node_create(elements[i], result);
+    }
+    free(elements);
+    return result;
+}
+
+List persistent_list_to_list(PersistentList list) // O(n)
+{
+    List newlist = list_create();
+    for (; list != NULL; list = list->next)
+    {
+        list_insert_last(newlist, list->element);
+    }
+    return newlist;
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "list.h"
+
+#include <stdbool.h>
+
+/**
+ * @brief An immutable list whose versions share their nodes.
+ *
+ * No function changes a list: each one returns a new version, which shares
+ * every node it can with the old one, so keeping many versions costs memory
+ * in proportion to their differences only. The nodes are reference counted.
+ *
+ * Every PersistentList returned by these functions is owned by the caller,
+ * who must give it to persistent_list_release when done. The ones passed in
+ * are only borrowed. NULL is the empty list. The elements are never freed,
+ * since versions share them. The reference counts are not atomic, so the
+ * versions of one list must be used from one thread at a time.
+ */
+typedef struct PersistentList_* PersistentList;
+
+/**
+ * @brief Returns another reference to the same version of a list.
+ *
+ * @param list The persistent list.
+ * @return PersistentList The same list, to be released separately.
+ */
+PersistentList persistent_list_acquire(PersistentList list);
+
+/**
+ * @brief Releases a reference to a version of a list.
+ *
+ * Frees the nodes no other version uses.
+ *
+ * @param list The persistent list.
+ */
+void persistent_list_release(PersistentList list);
+
+/**
+ * @brief Returns the number of elements in the list.
+ *
+ * @param list The persistent list.
+ * @return ListIndex The number of elements in the list.
+ */
+ListIndex persistent_list_size(PersistentList list);
+
+/**
+ * @brief Returns the first element of the list.
+ *
+ * @param list The persistent list.
+ * @return void* The first element, or NULL if the list is empty.
+ */
+void* persistent_list_first(PersistentList list);
+
+/**
+ * @brief Returns the element at the given position.
+ *
+ * @param list The persistent list.
+ * @param position The position of the element.
+ * @return void* The element, or NULL if the position does not exist.
+ */
+void* persistent_list_get(PersistentList list, ListIndex position);
+
+/**
+ * @brief Returns the list with an element inserted at the beginning.
+ *
+ * Takes O(1): the new version shares all the nodes of the old one.
+ *
+ * @param list The persistent list.
+ * @param element The element to insert.
+ * @return PersistentList The new version.
+ */
+PersistentList persistent_list_prepend(PersistentList list, void* element);
+
+/**
+ * @brief Returns the list without its first element.
+ *
+ * Takes O(1): the new version is the old one's second node.
+ *
+ * @param list The persistent list.
+ * @return PersistentList The new version (NULL if it is empty).
+ */
+PersistentList persistent_list_rest(PersistentList list);
+
+/**
+ * @brief Returns the elements from the given position to the end.
+ *
+ * Takes O(start) to find the node, but no memory: the suffix is shared.
+ *
+ * @param list The persistent list.
+ * @param start The position of the first element to include.
+ * @return PersistentList The new version (NULL if start is past the end).
+ */
+PersistentList persistent_list_suffix(PersistentList list, ListIndex start);
+
+/**
+ * @brief Returns the list with an element inserted at the given position.
+ *
+ * Takes O(position): the nodes before it are copied, the rest are shared.
+ *
+ * @param list The persistent list.
+ * @param element The element to insert.
+ * @param position The position where the element will be inserted.
+ * @return PersistentList The new version, or another reference to the same
+ * one if the position does not exist.
+ */
+PersistentList persistent_list_insert(
+    PersistentList list,
+    void* element,
+    ListIndex position
+);
+
+/**
+ * @brief Returns the list without the element at the given position.
+ *
+ * Takes O(position): the nodes before it are copied, the rest are shared.
+ *
+ * @param list The persistent list.
+ * @param position The position of the element to remove.
+ * @return PersistentList The new version, or another reference to the same
+ * one if the position does not exist.
+ */
+PersistentList persistent_list_remove(PersistentList list, ListIndex position);
+
+/**
+ * @brief Returns the list with the element at the given position replaced.
+ *
+ * Takes O(position): the nodes before it are copied, the rest are shared.
+ *
+ * @param list The persistent list.
+ * @param element The new element.
+ * @param position The position of the element to replace.
+ * @return PersistentList The new version, or another reference to the same
+ * one if the position does not exist.
+ */
+PersistentList persistent_list_set(
+    PersistentList list,
+    void* element,
+    ListIndex position
+);
+
+/**
+ * @brief Returns a persistent list with the elements of a list.
+ *
+ * @param list The linked list.
+ * @return PersistentList A persistent list with the same elements.
+ */
+PersistentList persistent_list_from_list(List list);
+
+/**
+ * @brief Returns a list with the elements of a persistent list.
+ *
+ * @param list The persistent list.
+ * @return List A linked list with the same elements.
+ */
+List persistent_list_to_list(PersistentList list);
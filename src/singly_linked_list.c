@@ -1,43 +1,567 @@
 #include "list.h"
+#include "hash_table.h"
+#include "list_layout.h"
 #include <stdbool.h>
 #include <stdlib.h>
 
-typedef struct Node_* Node;
+typedef struct Node_* Node; // struct Node_ and struct List_ are in
+                             // list_layout.h
 
-struct Node_
+typedef struct DoublyNode_* DoublyNode;
+
+struct DoublyNode_
 {
-        void* element;
-        Node next;
-}; // Struct = struct Node_ ; Pointer = Node
+        struct Node_ node; // First, so a DoublyNode is also a Node
+        Node previous;     // Node before this one (NULL at the head)
+}; // Struct = struct DoublyNode_ ; Pointer = DoublyNode
+
+typedef struct Skip_* Skip;
 
-struct List_
+struct Skip_
 {
-        Node head;
-        Node tail;
-        int size;
-        Node current;
-}; // Struct = struct List_ ; Pointer = List
+        Node node;      // Node this entry stands for (NULL for the sentinel)
+        Skip next;      // Next entry on the same level
+        Skip down;      // Same node one level below (NULL on level 0)
+        ListIndex span; // Positions from this entry's node to the next one's
+}; // Struct = struct Skip_ ; Pointer = Skip
+
+#define INDEX_LEVELS 16 // Each level keeps ~1/4 of the one below (4^16 nodes)
 
-Node node_create(Node next, void* element) // O(1)
+typedef struct Chunk_* Chunk;
+
+struct Chunk_
 {
-    Node node = malloc(sizeof(struct Node_)); // Allocates memory for the node
-    node->element = element;                  // Assigns element address
-    node->next = next;                        // Assigns next address
+        Chunk next;
+        ListIndex count;      // Nodes it has room for
+        size_t node_bytes;    // Size of each, which a splice may have taken
+                              // from a list with other nodes
+        struct Node_ nodes[]; // Or DoublyNodes, if the list is doubly
+}; // Struct = struct Chunk_ ; Pointer = Chunk
+
+static char chunk_mark; // Stored in the nodes of chunks by list_wipe, to
+                        // tell them from the nodes allocated one by one
+
+static Node node_previous(Node node) // O(1), only for nodes of a doubly list
+{
+    return ((DoublyNode)node)->previous;
+}
+
+static void node_set_previous(List list, Node node, Node previous) // O(1)
+{
+    if (list->doubly && node != NULL) // Singly nodes have no room for it
+    {
+        ((DoublyNode)node)->previous = previous;
+    }
+}
+
+static size_t node_bytes(List list) // O(1)
+{
+    return list->doubly ? sizeof(struct DoublyNode_) : sizeof(struct Node_);
+}
+
+static Node node_in_block(List list, Node block, ListIndex i) // O(1)
+{
+    return (Node)((char*)block + i * node_bytes(list)); // Doubly nodes are
+                                                       // larger than a Node
+}
+
+static Node node_create(List list, Node next, void* element) // O(1)
+{
+    Node node;
+    if (list->free_nodes != NULL) // If a released node can be reused
+    {
+        node = list->free_nodes;       // Takes it from the free list
+        list->free_nodes = node->next; // Advances the free list
+    }
+    else if (list->chunk_nodes == 0) // If the list is not pooled
+    {
+        node = malloc(node_bytes(list)); // Allocates memory for the node
+        list->malloc_nodes++;
+    }
+    else // Otherwise carves the node from the newest chunk
+    {
+        if (list->chunks == NULL ||
+            list->chunk_used == list->chunk_nodes) // If the chunk is exhausted
+        {
+            Chunk chunk = malloc(
+                sizeof(struct Chunk_) + list->chunk_nodes * node_bytes(list)
+            );                          // Allocates a whole chunk at once
+            chunk->next = list->chunks; // Chains it before the older ones
+            chunk->count = list->chunk_nodes;
+            chunk->node_bytes = node_bytes(list);
+            if (list->chunks == NULL) // The first one is also the oldest
+            {
+                list->chunks_last = chunk;
+            }
+            list->chunks = chunk;       // Becomes the newest chunk
+            list->chunk_used = 0;       // Nothing carved from it yet
+        }
+        node = node_in_block(
+            list, list->chunks->nodes, list->chunk_used++
+        ); // Next unused node
+    }
+    node->element = element;             // Assigns element address
+    node->next = next;                   // Assigns next address
+    node_set_previous(list, node, NULL); // Set by the caller, if doubly
     return node;
     // Useful since this function is called at least 3 times
 }
 
+static void node_destroy(List list, Node node) // O(1)
+{
+    if (list->chunks == NULL) // If every node was allocated one by one
+    {
+        free(node); // Gives the node back to the allocator
+        list->malloc_nodes--;
+        return;
+    }
+    if (list->free_nodes == NULL) // Otherwise pushes it onto the free list,
+    {                             // since it may be part of a chunk (which
+        list->free_last = node;   // is only freed by list_wipe)
+    }
+    node->next = list->free_nodes;
+    list->free_nodes = node;
+}
+
+// Positional index (a skip list over the nodes, counting positions)
+
+static int index_height(List list) // O(1)
+{
+    unsigned int bits = list->index_seed; // Xorshift, so the list does not
+    bits ^= bits << 13;                   // disturb the caller's rand()
+    bits ^= bits >> 17;
+    bits ^= bits << 5;
+    list->index_seed = bits;
+    int height = 0;
+    while (height < INDEX_LEVELS && (bits & 3) == 0) // Each level with 1/4
+    {
+        height++;   // probability, so most nodes get no entry at all
+        bits >>= 2; // Two fresh bits per level
+    }
+    return height;
+}
+
+static void index_clear(List list) // O(n)
+{
+    for (int level = 0; level < list->index_levels; level++) // Every level
+    {
+        Skip entry = list->index[level].next; // Skips the sentinel
+        while (entry != NULL)                 // Frees the level's entries
+        {
+            Skip nextEntry = entry->next;
+            free(entry);
+            entry = nextEntry;
+        }
+        list->index[level].next = NULL; // Sentinel now ends the level
+    }
+    list->index_levels = 1; // Back to a single empty level
+    list->index_stale = false;
+}
+
+static void index_rebuild(List list) // O(n)
+{
+    index_clear(list);             // Starts from an empty index
+    Skip last[INDEX_LEVELS];       // Last entry of each level so far
+    ListIndex ranks[INDEX_LEVELS]; // Their positions (-1 for the sentinels)
+    for (int level = 0; level < INDEX_LEVELS; level++)
+    {
+        last[level] = &list->index[level];
+        ranks[level] = -1;
+    }
+    Node node = list->head;
+    for (ListIndex position = 0; node != NULL;
+         position++) // Traverses the list
+    {
+        int height = index_height(list); // Tower for this node
+        if (height > list->index_levels) // Grows the index if needed
+        {
+            list->index_levels = height;
+        }
+        Skip below = NULL;
+        for (int level = 0; level < height; level++) // Appends the tower
+        {
+            Skip entry = malloc(sizeof(struct Skip_));
+            entry->node = node;
+            entry->next = NULL;
+            entry->down = below;
+            entry->span = 0; // Set when the level gets its next entry
+            last[level]->next = entry;
+            last[level]->span = position - ranks[level];
+            last[level] = entry;
+            ranks[level] = position;
+            below = entry;
+        }
+        node = node->next;
+    }
+}
+
+static bool index_ready(List list) // O(1), or O(n) after a bulk change
+{
+    if (list->index == NULL) // If the list is not indexed
+    {
+        return false;
+    }
+    if (list->index_stale) // A bulk change left the index behind
+    {
+        index_rebuild(list);
+    }
+    return true;
+}
+
+static Node index_find(
+    List list,
+    ListIndex position,
+    Skip update[],
+    ListIndex ranks[]
+) // O(log n)
+{
+    int level = list->index_levels - 1; // Starts at the top sentinel
+    Skip entry = &list->index[level];
+    ListIndex rank = -1; // Sentinels sit before the head
+    while (true)
+    {
+        while (entry->next != NULL &&
+               rank + entry->span < position) // Moves right while the next
+                                              // entry is before position
+        {
+            rank += entry->span;
+            entry = entry->next;
+        }
+        if (update != NULL) // Records where each level stopped
+        {
+            update[level] = entry;
+            ranks[level] = rank;
+        }
+        if (level == 0)
+        {
+            break;
+        }
+        entry = entry->down; // Goes one level down
+        level--;
+    }
+    if (position == 0) // Nothing before the head
+    {
+        return NULL;
+    }
+    Node node = entry->node; // Finishes the walk on the nodes themselves
+    if (node == NULL)        // (a few steps, expected)
+    {
+        node = list->head;
+        rank = 0;
+    }
+    while (rank < position - 1)
+    {
+        node = node->next;
+        rank++;
+    }
+    return node; // Node at position - 1
+}
+
+static void index_link(
+    List list,
+    Skip update[],
+    ListIndex ranks[],
+    ListIndex position,
+    Node node
+) // O(log n)
+{
+    int height = index_height(list); // Tower for the new node
+    while (list->index_levels < height) // Grows the index if needed
+    {
+        Skip sentinel = &list->index[list->index_levels];
+        sentinel->next = NULL;
+        sentinel->span = 0;
+        update[list->index_levels] = sentinel;
+        ranks[list->index_levels] = -1;
+        list->index_levels++;
+    }
+    Skip below = NULL;
+    for (int level = 0; level < height; level++) // Splits the spans around
+    {                                            // the new entries
+        Skip entry = malloc(sizeof(struct Skip_));
+        entry->node = node;
+        entry->down = below;
+        entry->next = update[level]->next;
+        entry->span = ranks[level] + update[level]->span + 1 - position;
+        update[level]->next = entry;
+        update[level]->span = position - ranks[level];
+        below = entry;
+    }
+    for (int level = height; level < list->index_levels; level++)
+    {
+        update[level]->span++; // Higher levels just jump over one more node
+    }
+}
+
+static void index_unlink(List list, Skip update[], Node node) // O(log n)
+{
+    for (int level = 0; level < list->index_levels; level++)
+    {
+        Skip entry = update[level]->next;
+        if (entry != NULL && entry->node == node) // If the node has an entry
+        {                                         // here, removes it
+            update[level]->span += entry->span - 1;
+            update[level]->next = entry->next;
+            free(entry);
+        }
+        else
+        {
+            update[level]->span--; // Otherwise jumps over one less node
+        }
+    }
+    while (list->index_levels > 1 &&
+           list->index[list->index_levels - 1].next ==
+               NULL) // Drops empty levels from the top
+    {
+        list->index_levels--;
+    }
+}
+
+static void index_insert(List list, ListIndex position, Node node) // O(log n)
+{
+    if (list->index == NULL ||
+        list->index_stale) // Nothing to do if not indexed, or if the node is
+                           // already linked and the rebuild will include it
+    {
+        return;
+    }
+    Skip update[INDEX_LEVELS];
+    ListIndex ranks[INDEX_LEVELS];
+    index_find(list, position, update, ranks); // Entries before the position
+    index_link(list, update, ranks, position, node);
+}
+
+static void finger_forget(List list, ListIndex position) // O(1)
+{
+    if (list->finger != NULL &&
+        position <= list->finger_position) // If the change happened at or
+                                           // before the finger, it is lost
+    {
+        list->finger = NULL;
+    }
+}
+
+// Node pool
+
+static Node pool_take(List list, ListIndex count) // O(1)
+{
+    if (list->chunks != NULL &&
+        list->chunk_nodes - list->chunk_used >=
+            count) // If the newest chunk has room, carves them all from it
+    {
+        Node nodes =
+            node_in_block(list, list->chunks->nodes, list->chunk_used);
+        list->chunk_used += count;
+        return nodes;
+    }
+    Chunk chunk = malloc(sizeof(struct Chunk_) + count * node_bytes(list));
+    chunk->count = count;
+    chunk->node_bytes = node_bytes(list);
+    if (list->chunks != NULL) // Otherwise one chunk just for them, behind the
+    {                         // newest chunk, which chunk_used refers to
+        chunk->next = list->chunks->next;
+        list->chunks->next = chunk;
+        if (chunk->next == NULL) // Behind the only chunk, so the oldest
+        {
+            list->chunks_last = chunk;
+        }
+    }
+    else // Or the only chunk, already exhausted
+    {
+        chunk->next = NULL;
+        list->chunks = chunk;
+        list->chunks_last = chunk;
+        list->chunk_used = list->chunk_nodes;
+    }
+    return chunk->nodes;
+}
+
+// Hash index
+
+static ListIndex hash_index_stored(List list, ListIndex position) // O(1)
+{
+    return (ListIndex)((size_t)position - list->hash_base); // Wraps around
+}                                                            // like hash_base
+
+static void hash_index_prepend(List list, void* element) // O(1), at the head
+{
+    if (list->hash_index != NULL) // Only if a hash index is attached
+    {
+        sll_hash_table_add(list->hash_index, element);
+        list->hash_base++; // Every recorded position moves one forward
+        sll_hash_table_set_first(
+            list->hash_index, element, hash_index_stored(list, 0)
+        ); // And its first occurrence is now this one
+    }
+}
+
+static void hash_index_remove_first(List list, void* element) // O(1)
+{
+    if (list->hash_index != NULL) // Only if a hash index is attached
+    {
+        list->hash_base--; // Every recorded position moves one back
+        if (sll_hash_table_remove(list->hash_index, element) >
+            0) // Its next occurrence, wherever it is, becomes the first
+        {
+            list->hash_stale = true;
+        }
+    }
+}
+
+static void hash_index_remove_last(List list, void* element) // O(1)
+{
+    if (list->hash_index != NULL) // No position moves, and if the element
+    {                             // occurs again, its first one is earlier
+        sll_hash_table_remove(list->hash_index, element);
+    }
+}
+
+static void hash_index_add(List list, void* element) // O(1)
+{
+    if (list->hash_index != NULL) // Only if a hash index is attached
+    {
+        sll_hash_table_add(list->hash_index, element);
+        list->hash_stale = true; // Later positions moved
+    }
+}
+
+static void hash_index_append(
+    List list,
+    void* element,
+    ListIndex position
+) // O(1), for an element inserted at the end
+{
+    if (list->hash_index != NULL &&
+        sll_hash_table_add(list->hash_index, element) == 1 &&
+        !list->hash_stale) // Nothing moved, and a new element's first
+    {                      // occurrence is this one
+        sll_hash_table_set_first(
+            list->hash_index, element, hash_index_stored(list, position)
+        );
+    }
+}
+
+static void hash_index_remove(List list, void* element) // O(1)
+{
+    if (list->hash_index != NULL) // Only if a hash index is attached
+    {
+        sll_hash_table_remove(list->hash_index, element);
+        list->hash_stale = true; // Later positions moved
+    }
+}
+
+static void hash_index_rebuild(List list) // O(n)
+{
+    sll_hash_table_forget_firsts(list->hash_index);
+    list->hash_base = 0; // Recorded positions are the real ones again
+    ListIndex position = 0;
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        if (sll_hash_table_first(list->hash_index, node->element) ==
+            -1) // Only the first occurrence of each element is recorded
+        {
+            sll_hash_table_set_first(list->hash_index, node->element, position);
+        }
+        position++;
+    }
+    list->hash_stale = false;
+}
+
+static bool hash_index_answers(List list, bool (*equal)(void*, void*)) // O(1)
+{
+    return list->hash_index != NULL &&
+           list->hash_equal == equal; // The index only knows its own equality
+}
+
 List list_create() // O(1)
+{
+    return list_create_pooled(0); // Without chunks, each node is a malloc
+}
+
+List list_create_doubly() // O(1)
+{
+    List list = list_create(); // Same as list_create, but each node also
+    list->doubly = true;       // points back
+    return list;
+}
+
+List list_create_pooled(ListIndex chunk_nodes) // O(1)
 {
     List list = malloc(sizeof(struct List_)); // Allocates memory for the list
     list->head = NULL;                        // Sets head to NULL
     list->tail = NULL;                        // Sets tail to NULL
     list->size = 0;                           // Sets size to 0
+    list->current = NULL;                     // Iterator not started
+    list->chunk_nodes = chunk_nodes > 0 ? chunk_nodes : 0; // Pooled or not
+    list->chunk_used = 0;                                  // No chunk yet
+    list->chunks = NULL;                                   // No chunks yet
+    list->chunks_last = NULL;
+    list->free_nodes = NULL;                               // Nothing released
+    list->free_last = NULL;
+    list->malloc_nodes = 0;
+    list->index = NULL;                                    // Not indexed
+    list->index_levels = 0;
+    list->index_stale = false;
+    list->index_seed = 2463534242u; // Any nonzero seed works for xorshift
+    list->finger = NULL;            // No list_get yet
+    list->finger_position = 0;
+    list->hash_index = NULL; // No hash index
+    list->hash_equal = NULL;
+    list->hash_stale = false;
+    list->hash_base = 0;
+    list->doubly = false; // Nodes only point forward
     return list;
 }
 
+static void nodes_free_loose(Node node) // O(n)
+{
+    while (node != NULL) // Frees the nodes not marked as part of a chunk
+    {
+        Node nextNode = node->next;
+        if (node->element != &chunk_mark)
+        {
+            free(node);
+        }
+        node = nextNode;
+    }
+}
+
 void list_wipe(List list, void (*free_element)(void*)) // O(n)
 {
+    if (list->chunks != NULL) // If the list owns chunks
+    {
+        Node node = list->head; // Elements still need a traversal...
+        while (free_element != NULL && node != NULL) // ...but only if freed
+        {
+            free_element(node->element); // Cleans the element
+            node = node->next;           // Advances to the next
+        }
+        if (list->malloc_nodes > 0) // Some nodes were allocated one by one,
+        {                           // so the nodes of the chunks are marked
+            for (Chunk chunk = list->chunks; chunk != NULL;
+                 chunk = chunk->next) // to tell the others apart
+            {
+                for (ListIndex i = 0; i < chunk->count; i++)
+                {
+                    Node node = (Node)((char*)chunk->nodes +
+                                       i * chunk->node_bytes); // Its own size
+                    node->element = &chunk_mark;
+                }
+            }
+            nodes_free_loose(list->head);
+            nodes_free_loose(list->free_nodes);
+            list->malloc_nodes = 0;
+        }
+        while (list->chunks != NULL) // Nodes go away chunk by chunk, O(chunks)
+        {
+            Chunk chunk = list->chunks; // Saves the chunk
+            list->chunks = chunk->next; // Advances to the older one
+            free(chunk);                // Cleans every node inside it
+        }
+        list->chunk_used = 0;    // Next node_create starts a fresh chunk
+        list->free_nodes = NULL; // Released nodes lived in the freed chunks
+        return;
+    }
     Node node = list->head; // Gets node address from head
     while (node != NULL)    // Traverses from head to tail
     {
@@ -50,21 +574,74 @@ void list_wipe(List list, void (*free_element)(void*)) // O(n)
         node = node->next;        // Advances to the next
         free(previousNode);       // Cleans the old node
     }
+    list->malloc_nodes = 0;
     // Another useful function, used twice
 }
 
 void list_destroy(List list, void (*free_element)(void*)) // O(n)
 {
+    list_set_indexed(list, false);         // Cleans the index, if any
+    list_set_hash_index(list, NULL, NULL); // And the hash index
     list_wipe(list, free_element); // Cleans the nodes and elements of the list
     free(list);                    // Finally, cleans the list
 }
 
+void list_set_hash_index(
+    List list,
+    size_t (*hash)(void*),
+    bool (*equal)(void*, void*)
+) // O(n)
+{
+    if (list->hash_index != NULL) // Drops the current one, if any
+    {
+        sll_hash_table_destroy(list->hash_index);
+        list->hash_index = NULL;
+        list->hash_equal = NULL;
+    }
+    if (hash == NULL) // No new one
+    {
+        return;
+    }
+    list->hash_index = sll_hash_table_create(hash, equal);
+    list->hash_equal = equal;
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        sll_hash_table_add(list->hash_index, node->element); // Counts them all
+    }
+    list->hash_stale = true; // Positions are recorded on the first list_find
+}
+
+void list_set_indexed(List list, bool indexed) // O(n)
+{
+    if (indexed && list->index == NULL) // Builds the index
+    {
+        list->index = malloc(INDEX_LEVELS * sizeof(struct Skip_));
+        for (int level = 0; level < INDEX_LEVELS; level++) // Sentinels
+        {
+            list->index[level].node = NULL;
+            list->index[level].next = NULL;
+            list->index[level].down =
+                level > 0 ? &list->index[level - 1] : NULL;
+            list->index[level].span = 0;
+        }
+        list->index_levels = 1;
+        index_rebuild(list);
+    }
+    else if (!indexed && list->index != NULL) // Drops the index
+    {
+        index_clear(list);
+        free(list->index);
+        list->index = NULL;
+        list->index_levels = 0;
+    }
+}
+
 bool list_is_empty(List list) // O(1)
 {
     return list->size == 0;
 }
 
-int list_size(List list) // O(1)
+ListIndex list_size(List list) // O(1)
 {
     return list->size;
 }
@@ -87,25 +664,63 @@ void* list_get_last(List list) // O(1)
     return list->tail->element;
 }
 
-void* list_get(List list, int position) // O(n)
+void* list_get(List list, ListIndex position) // O(n)
 {
     if (position > list_size(list) - 1 ||
         position < 0) // Cannot access positions that do not exist
     {
         return NULL;
     }
-    Node node = list->head;            // Created node receives the head address
-    for (int i = 0; i < position; i++) // Walks to the desired position
+    Node node = list->head; // Created node receives the head address
+    ListIndex i = 0;
+    bool indexed = index_ready(list);
+    if (list->finger != NULL && list->finger_position <= position &&
+        (!indexed ||
+         position - list->finger_position < 8)) // Resumes from the last
+                                                // list_get (an index search
+                                                // wins over long walks)
+    {
+        node = list->finger;
+        i = list->finger_position;
+    }
+    else if (indexed) // If indexed, the index jumps to the position
+    {
+        node = index_find(list, position + 1, NULL, NULL);
+        i = position;
+    }
+    for (; i < position; i++) // Walks to the desired position
     {
         node = node->next; // Moves forward
     }
+    list->finger = node;              // Remembers it, so a loop over the
+    list->finger_position = position; // positions is O(n), not O(n^2)
     return node->element;
 }
 
-int list_find(List list, bool (*equal)(void*, void*), void* element) // O(n)
+ListIndex list_find(
+    List list,
+    bool (*equal)(void*, void*),
+    void* element
+) // O(n), or O(1) if hashed (plus O(n) once after a change that moved it)
 {
-    Node node = list->head;            // Node receives head address
-    for (int i = 0; node != NULL; i++) // Traverses from first to last node
+    if (hash_index_answers(list, equal)) // The hash index knows whether it
+    {                                    // occurs, and its first position
+        if (sll_hash_table_count(list->hash_index, element) == 0)
+        {
+            return -1;
+        }
+        if (list->hash_stale) // Positions moved since they were recorded
+        {
+            hash_index_rebuild(list);
+        }
+        return (ListIndex)((size_t)sll_hash_table_first(
+                               list->hash_index, element
+                           ) +
+                           list->hash_base);
+    }
+    Node node = list->head; // Node receives head address
+    for (ListIndex i = 0; node != NULL;
+         i++) // Traverses from first to last node
     {
         if (equal(element, node->element)) // If elements are equal
         {
@@ -118,21 +733,25 @@ int list_find(List list, bool (*equal)(void*, void*), void* element) // O(n)
 
 void list_insert_first(List list, void* element) // O(1)
 {
-    Node node = node_create(list->head, element); // Creates a node
-    list->head = node;                            // Sets as head
-    if (list_is_empty(list))                      // If the list is empty
+    Node node = node_create(list, list->head, element); // Creates a node
+    node_set_previous(list, list->head, node); // Old head now comes after it
+    list->head = node;                         // Sets as head
+    if (list_is_empty(list)) // If the list is empty
     {
         list->tail = node; // Tail also receives the node
     }
     list->size++; // Increments list size
     // If the list is empty, the next of the head is obviously NULL, so both
     // tail and head for this first element have next defined as NULL
+    index_insert(list, 0, node);   // Keeps the index in step, if any
+    finger_forget(list, 0);            // Every position moved
+    hash_index_prepend(list, element); // Counts it in the hash index, if any
 }
 
 void list_insert_last(List list, void* element) // O(1)
 {
-    Node node = node_create(NULL, element); // Creates a node
-    if (list_is_empty(list))                // If the list is empty
+    Node node = node_create(list, NULL, element); // Creates a node
+    if (list_is_empty(list))                      // If the list is empty
     {
         list->head = node; // Head also receives the node
     }
@@ -140,11 +759,56 @@ void list_insert_last(List list, void* element) // O(1)
     {
         list->tail->next = node; // Tail's next points to node
     }
-    list->tail = node; // Node becomes the new tail
-    list->size++;      // Increments list size
+    node_set_previous(list, node, list->tail); // Points back to the old tail
+    list->tail = node;                         // Node becomes the new tail
+    list->size++;                              // Increments list size
+    index_insert(list, list->size - 1, node);         // Keeps the index in step
+    hash_index_append(list, element, list->size - 1); // Counts it, if hashed
 }
 
-void list_insert(List list, void* element, int position) // O(n)
+void list_insert_last_bulk(List list, void** array, ListIndex count) // O(n)
+{
+    if (count <= 0) // Nothing to insert
+    {
+        return;
+    }
+    Node nodes = pool_take(list, count); // Contiguous nodes for all of them,
+                                         // the existing ones stay in place
+    Node previousNode = list->tail;      // New nodes go after the tail
+    for (ListIndex i = 0; i < count; i++) // Links them in one pass
+    {
+        Node node = node_in_block(list, nodes, i);
+        node->element = array[i];
+        node->next = NULL;
+        node_set_previous(list, node, previousNode);
+        hash_index_append(list, array[i], list->size + i); // If hashed
+        if (previousNode == NULL) // If the list was empty
+        {
+            list->head = node; // First one becomes the head
+        }
+        else
+        {
+            previousNode->next = node;
+        }
+        previousNode = node;
+    }
+    list->tail = previousNode; // Last one becomes the tail
+    list->size += count;
+    if (list->index != NULL) // Rebuilt when next used, in O(n) instead of
+    {                        // O(n log n) for separate inserts
+        list->index_stale = true;
+    }
+}
+
+List list_from_array(void** array, ListIndex count) // O(n)
+{
+    List list = list_create();                 // Not pooled, but its nodes
+    list_insert_last_bulk(list, array, count); // are one chunk of exactly
+                                               // count nodes
+    return list;
+}
+
+void list_insert(List list, void* element, ListIndex position) // O(n)
 {
     if (position < 0 ||
         position >
@@ -164,18 +828,33 @@ void list_insert(List list, void* element, int position) // O(n)
         list_insert_last(list, element);
         return;
     }
-    Node previousNode = list->head->next; // Receives the head address
-    for (int i = 1; i < position - 1;
-         i++) // Moves one node after head up to the node before the position
+    Skip update[INDEX_LEVELS];
+    ListIndex ranks[INDEX_LEVELS];
+    bool indexed = index_ready(list);
+    Node previousNode = list->head; // Receives the head address
+    if (indexed) // If indexed, the index jumps to the node before
+    {
+        previousNode = index_find(list, position, update, ranks);
+    }
+    for (ListIndex i = 0; !indexed && i < position - 1;
+         i++) // Moves from the head up to the node before the position
     {
         previousNode = previousNode->next; // Moves forward
     }
     Node node = node_create(
-        previousNode->next, element
+        list, previousNode->next, element
     ); // New node points to the next node (the one previously at the target
        // position)
     previousNode->next = node; // Previous node points to the new node
-    list->size++;              // Increases list size
+    node_set_previous(list, node, previousNode); // And back, if doubly
+    node_set_previous(list, node->next, node);
+    list->size++; // Increases list size
+    if (indexed)
+    {
+        index_link(list, update, ranks, position, node); // Adds its entries
+    }
+    finger_forget(list, position); // Positions from here on moved
+    hash_index_add(list, element); // Counts it, if hashed
 }
 
 void* list_remove_first(List list) // O(1)
@@ -184,12 +863,22 @@ void* list_remove_first(List list) // O(1)
     {
         return NULL; // Returns no element
     }
-    Node node = list->head;        // Saves the head node address
-    void* element = node->element; // Saves the head element address
-    list->head = node->next;       // Sets next element as head
-    free(node);                    // Frees the first element
-    list->size--;                  // Decrements list size
-    if (list_is_empty(list))       // If the list becomes empty after this
+    if (index_ready(list)) // Removes the head's entries from the index
+    {
+        Skip update[INDEX_LEVELS];
+        ListIndex ranks[INDEX_LEVELS];
+        index_find(list, 0, update, ranks);
+        index_unlink(list, update, list->head);
+    }
+    finger_forget(list, 0);           // Every position moved
+    Node node = list->head;           // Saves the head node address
+    void* element = node->element;    // Saves the head element address
+    list->head = node->next;          // Sets next element as head
+    node_set_previous(list, list->head, NULL); // Nothing before it now
+    node_destroy(list, node);                  // Frees the first element
+    hash_index_remove_first(list, element);    // Uncounts it, if hashed
+    list->size--;                              // Decrements list size
+    if (list_is_empty(list)) // If the list becomes empty after this
     {
         list->tail = NULL; // Sets tail to NULL as well
     }
@@ -198,7 +887,7 @@ void* list_remove_first(List list) // O(1)
     // of the previous head, which will be NULL
 }
 
-void* list_remove_last(List list) // O(n)
+void* list_remove_last(List list) // O(n), or O(1) if doubly
 {
     if (list_is_empty(list)) // If the list is empty
     {
@@ -211,21 +900,34 @@ void* list_remove_last(List list) // O(n)
             list
         ); // Removes the first (easier and saves memory and complexity)
     }
-    Node node = list->head; // This node initially receives the head address
-    void* element = list->tail->element; // Saves the tail element address
-    while (node->next->next != NULL)     // Advances until next->next is NULL,
-                                         // reaching the second-to-last node
+    finger_forget(list, list->size - 1); // Only if it was on the tail
+    Node node = list->head; // This node initially receives the head address
+    void* element = list->tail->element; // Saves the tail element address
+    if (index_ready(list)) // If indexed, the index jumps to the node before
+    {
+        Skip update[INDEX_LEVELS];
+        ListIndex ranks[INDEX_LEVELS];
+        node = index_find(list, list->size - 1, update, ranks);
+        index_unlink(list, update, list->tail);
+    }
+    else if (list->doubly) // The tail knows the node before it
+    {
+        node = node_previous(list->tail);
+    }
+    while (node->next->next != NULL) // Advances until next->next is NULL,
+                                     // reaching the second-to-last node
     {
         node = node->next; // Receives the next address
     }
-    free(list->tail);  // Frees the tail node
-    list->tail = node; // Sets second-to-last node as tail
-    node->next = NULL; // Removes the node's next pointer
-    list->size--;      // Decrements list size
-    return element;    // Returns element
+    node_destroy(list, list->tail);        // Frees the tail node
+    hash_index_remove_last(list, element); // Uncounts it, if hashed
+    list->tail = node;                // Sets second-to-last node as tail
+    node->next = NULL;                // Removes the node's next pointer
+    list->size--;                     // Decrements list size
+    return element;                   // Returns element
 }
 
-void* list_remove(List list, int position) // O(n)
+void* list_remove(List list, ListIndex position) // O(n)
 {
     if (position < 0 || position > list_size(list) - 1 ||
         list_is_empty(list)) // Does not return or remove any address that does
@@ -239,19 +941,34 @@ void* list_remove(List list, int position) // O(n)
     {
         return list_remove_first(list); // Removes the first
     }
-    Node previousNode = list->head->next; // Receives the address after head
-    for (int i = 1; i < position - 1;
-         i++) // Moves one node after head up to the node before the position
+    finger_forget(list, position); // Positions from here on move
+    Skip update[INDEX_LEVELS];
+    ListIndex ranks[INDEX_LEVELS];
+    bool indexed = index_ready(list);
+    Node previousNode = list->head; // Receives the head address
+    if (indexed) // If indexed, the index jumps to the node before
+    {
+        previousNode = index_find(list, position, update, ranks);
+        index_unlink(list, update, previousNode->next);
+    }
+    for (ListIndex i = 0; !indexed && i < position - 1;
+         i++) // Moves from the head up to the node before the position
     {
         previousNode = previousNode->next; // Moves forward
     }
     Node node = previousNode->next;  // Saves the address of the node to remove
     previousNode->next = node->next; // Links the previous node to the next,
                                      // reconnecting the list
-    void* element = node->element;   // Saves the node's element address
-    free(node);                      // Frees the node
-    list->size--;                    // Decrements list size
-    return element;                  // Returns element
+    node_set_previous(list, node->next, previousNode); // And back, if doubly
+    if (node == list->tail)          // If the removed node is the tail
+    {
+        list->tail = previousNode; // Previous node becomes the tail
+    }
+    void* element = node->element;    // Saves the node's element address
+    node_destroy(list, node);         // Frees the node
+    hash_index_remove(list, element); // Uncounts it, if hashed
+    list->size--;                     // Decrements list size
+    return element;                   // Returns element
 }
 
 void list_make_empty(List list, void (*free_element)(void*)) // O(n)
@@ -260,26 +977,42 @@ void list_make_empty(List list, void (*free_element)(void*)) // O(n)
     list->head = NULL;             // Resets everything to initial state
     list->tail = NULL;
     list->size = 0;
+    list->finger = NULL;
+    if (list->index != NULL) // An empty list has empty indexes
+    {
+        index_clear(list);
+    }
+    if (list->hash_index != NULL)
+    {
+        sll_hash_table_clear(list->hash_index);
+    }
+    list->hash_stale = false; // No positions to record
+    list->hash_base = 0;
 }
 
 void list_to_array(List list, void** out_array)
 {
-    Node node = list->head;            // Receives the head address
-    for (int i = 0; node != NULL; i++) // Traverses from first node until null
+    Node node = list->head; // Receives the head address
+    for (ListIndex i = 0; node != NULL;
+         i++) // Traverses from first node until null
     {
         out_array[i] = node->element; // Adds element to the array
         node = node->next;            // Advances to the next
     }
 }
 
-int list_count_all(
+ListIndex list_count_all(
     List list,
     bool (*equal)(void*, void*),
     void* element
 ) // O(n)
 {
+    if (hash_index_answers(list, equal)) // The hash index already knows
+    {
+        return sll_hash_table_count(list->hash_index, element);
+    }
     Node node = list->head; // Receives the head address
-    int i = 0;              // Sets counter to 0
+    ListIndex i = 0;        // Sets counter to 0
     while (node != NULL)    // Traverses from first to last element
     {
         if (equal(element, node->element)) // If equal
@@ -291,16 +1024,22 @@ int list_count_all(
     return i; // Returns the counter
 }
 
-int list_remove_all(
+ListIndex list_remove_all(
     List list,
     bool (*equal_element)(void*, void*),
     void (*free_element)(void*),
     void* element
 ) // O(n) - The hardest one so far
 {
-    int occurrences = 0;      // Initializes occurrence counter
-    Node node = list->head;   // Receives the head address
-    Node previousNode = NULL; // Will be used later to track the previous node
+    if (hash_index_answers(list, equal_element) &&
+        sll_hash_table_count(list->hash_index, element) ==
+            0) // If the hash index knows it is absent, nothing to remove
+    {
+        return 0;
+    }
+    ListIndex occurrences = 0; // Initializes occurrence counter
+    Node node = list->head;    // Receives the head address
+    Node previousNode = NULL;  // Will be used later to track the previous node
     while (node != NULL)      // Traverses the entire list
     {
         if (equal_element(
@@ -320,19 +1059,21 @@ int list_remove_all(
                 list->head = node->next; // Sets next node as head (since head
                                          // is being removed)
             }
+            node_set_previous(list, node->next, previousNode); // If doubly
             if (node->next == NULL) // If node's next is null (at the tail)
             {
                 list->tail = previousNode; // Previous node becomes the tail
             }
+            hash_index_remove(list, node->element); // Before it is freed
             if (free_element != NULL) // If free_element is not NULL
             {
                 free_element(node->element); // Cleans the element
             }
-            Node nextNode =
-                node->next;  // Saves the next node in a temporary variable
-            free(node);      // Frees the target node
-            node = nextNode; // Moves to the next node
-            list->size--;    // Decrements list size
+            Node nextNode = node->next; // Saves the next node in a temporary
+                                       // variable
+            node_destroy(list, node);  // Frees the target node
+            node = nextNode;           // Moves to the next node
+            list->size--;              // Decrements list size
         }
         else // If the condition is not met
         {
@@ -340,19 +1081,27 @@ int list_remove_all(
             node = node->next;   // Node advances forward
         }
     }
+    list->index_stale |= occurrences > 0; // Index is rebuilt when next used
+    finger_forget(list, 0);               // Positions may have moved
     return occurrences;
 }
 
-int list_remove_duplicates(
+ListIndex list_remove_duplicates(
     List list,
     bool (*equal_element)(void*, void*),
     void (*free_element)(void*),
     void* element
 ) // O(n)
 {
-    int occurrences = 0;      // Initializes occurrence counter
-    Node node = list->head;   // Receives the head address
-    Node previousNode = NULL; // Will be used later to track the previous node
+    if (hash_index_answers(list, equal_element) &&
+        sll_hash_table_count(list->hash_index, element) <=
+            1) // If the hash index knows there are no duplicates
+    {
+        return sll_hash_table_count(list->hash_index, element);
+    }
+    ListIndex occurrences = 0; // Initializes occurrence counter
+    Node node = list->head;    // Receives the head address
+    Node previousNode = NULL;  // Will be used later to track the previous node
     while (node != NULL)      // Traverses the entire list
     {
         if (equal_element(
@@ -360,25 +1109,32 @@ int list_remove_duplicates(
             )) // If current node equals the element
         {
             occurrences++; // Increments the counter
-            if (occurrences > 1)
+            if (occurrences == 1) // The first occurrence stays in the list
+            {
+                previousNode = node; // previousNode becomes the current node
+                node = node->next;   // Node advances forward
+            }
+            else
             {
                 previousNode->next =
                     node->next; // previousNode's next receives the node's next
                                 // (no if needed since head is never removed
                                 // here)
+                node_set_previous(list, node->next, previousNode); // If doubly
                 if (node->next == NULL) // If node's next is null (at the tail)
                 {
                     list->tail = previousNode; // Previous node becomes the tail
                 }
+                hash_index_remove(list, node->element); // Before it is freed
                 if (free_element != NULL) // If free_element is not NULL
                 {
                     free_element(node->element); // Cleans the element
                 }
-                Node nextNode =
-                    node->next;  // Saves the next node in a temporary variable
-                free(node);      // Frees the target node
-                node = nextNode; // Moves to the next node
-                list->size--;    // Decrements list size
+                Node nextNode = node->next; // Saves the next node in a
+                                            // temporary variable
+                node_destroy(list, node);   // Frees the target node
+                node = nextNode;            // Moves to the next node
+                list->size--;               // Decrements list size
             }
         }
         else // If the condition is not met
@@ -387,7 +1143,56 @@ int list_remove_duplicates(
             node = node->next;   // Node advances forward
         }
     }
-    return occurrences - 1; // Returns only the occurrences after the first
+    list->index_stale |= occurrences > 1; // Index is rebuilt when next used
+    finger_forget(list, 0);               // Positions may have moved
+    return occurrences; // Returns the number of occurrences
+}
+
+ListIndex list_unique(
+    List list,
+    size_t (*hash)(void*),
+    bool (*equal_element)(void*, void*),
+    void (*free_element)(void*)
+) // O(n)
+{
+    HashTable seen = sll_hash_table_create(hash, equal_element);
+    sll_hash_table_reserve(seen, list->size); // Never grows during the pass
+    ListIndex removed = 0;    // Initializes removal counter
+    Node node = list->head;   // Receives the head address
+    Node previousNode = NULL; // Will be used later to track the previous node
+    while (node != NULL)      // Traverses the entire list
+    {
+        if (sll_hash_table_add(seen, node->element) ==
+            1) // The first occurrence stays in the list
+        {
+            previousNode = node; // previousNode becomes the current node
+            node = node->next;   // Node advances forward
+            continue;
+        }
+        removed++;
+        previousNode->next =
+            node->next; // previousNode's next receives the node's next (no if
+                        // needed since the head is always a first occurrence)
+        node_set_previous(list, node->next, previousNode); // If doubly
+        if (node->next == NULL) // If node's next is null (at the tail)
+        {
+            list->tail = previousNode; // Previous node becomes the tail
+        }
+        hash_index_remove(list, node->element); // Before it is freed
+        if (free_element != NULL) // If free_element is not NULL
+        {
+            free_element(node->element); // Cleans the element
+        }
+        Node nextNode = node->next; // Saves the next node in a temporary
+                                    // variable
+        node_destroy(list, node);   // Frees the target node
+        node = nextNode;            // Moves to the next node
+        list->size--;               // Decrements list size
+    }
+    sll_hash_table_destroy(seen);
+    list->index_stale |= removed > 0; // Index is rebuilt when next used
+    finger_forget(list, 0);           // Positions may have moved
+    return removed;
 }
 
 List list_join(List list1, List list2) // O(n)
@@ -408,6 +1213,188 @@ List list_join(List list1, List list2) // O(n)
     return list;
 }
 
+void list_splice(List list1, List list2) // O(1)
+{
+    if (list1 == list2 || list_is_empty(list2)) // Nothing to move
+    {
+        return;
+    }
+    if (list1->doubly && !list2->doubly) // Singly nodes have no room to
+    {                                    // point back, so they are copied
+        Node node = list2->head;
+        while (node != NULL)
+        {
+            list_insert_last(list1, node->element);
+            node = node->next;
+        }
+        list_make_empty(list2, NULL);
+        return;
+    }
+    if (list2->chunks != NULL) // Nodes in chunks move along with them, even
+    {                          // if only one of the lists is pooled
+        if (list1->chunks != NULL) // Keeps list1's newest chunk first, since
+        {                          // chunk_used refers to it
+            list2->chunks_last->next = list1->chunks->next;
+            list1->chunks->next = list2->chunks;
+            if (list2->chunks_last->next == NULL) // list1 had one chunk
+            {
+                list1->chunks_last = list2->chunks_last;
+            }
+        }
+        else // list2's newest chunk may have another size, so it counts
+        {    // as exhausted
+            list1->chunks = list2->chunks;
+            list1->chunks_last = list2->chunks_last;
+            list1->chunk_used = list1->chunk_nodes;
+        }
+    }
+    if (list2->free_nodes != NULL) // Its released nodes are reused by list1
+    {
+        list2->free_last->next = list1->free_nodes;
+        if (list1->free_nodes == NULL)
+        {
+            list1->free_last = list2->free_last;
+        }
+        list1->free_nodes = list2->free_nodes;
+    }
+    if (list_is_empty(list1)) // Links list2's nodes after list1's tail
+    {
+        list1->head = list2->head;
+    }
+    else
+    {
+        list1->tail->next = list2->head;
+    }
+    node_set_previous(list1, list2->head, list1->tail); // If doubly
+    list1->tail = list2->tail;
+    list1->size += list2->size;
+    list1->malloc_nodes += list2->malloc_nodes;
+    for (Node node = list2->head; list1->hash_index != NULL && node != NULL;
+         node = node->next) // A hash index must count every moved element,
+    {                       // which costs O(m)
+        sll_hash_table_add(list1->hash_index, node->element);
+        list1->hash_stale = true;
+    }
+    if (list2->hash_index != NULL)
+    {
+        sll_hash_table_clear(list2->hash_index);
+    }
+    if (list1->index != NULL) // Both indexes are rebuilt when next used
+    {
+        list1->index_stale = true;
+    }
+    if (list2->index != NULL)
+    {
+        list2->index_stale = true;
+    }
+    list2->head = NULL; // list2 is left empty, ready to be reused
+    list2->tail = NULL;
+    list2->size = 0;
+    list2->current = NULL;
+    list2->finger = NULL;
+    list2->chunks = NULL;     // Its chunks and released nodes now belong
+    list2->free_nodes = NULL; // to list1
+    list2->chunk_used = 0;
+    list2->malloc_nodes = 0;
+}
+
+static Node node_split(Node node, ListIndex count) // O(count)
+{
+    for (ListIndex i = 1; node != NULL && i < count;
+         i++) // Walks to the last node of the run
+    {
+        node = node->next;
+    }
+    if (node == NULL) // Shorter than count, nothing left after it
+    {
+        return NULL;
+    }
+    Node rest = node->next; // Cuts the run off the rest
+    node->next = NULL;
+    return rest;
+}
+
+static Node node_merge(
+    Node left,
+    Node right,
+    int (*compare)(void*, void*),
+    Node* last
+) // O(n)
+{
+    struct Node_ first;   // Placeholder before the merged run
+    Node tail = &first;   // Last node of the merged run
+    while (left != NULL && right != NULL) // Takes the smaller head each time
+    {
+        if (compare(left->element, right->element) <=
+            0) // On ties, left first, which keeps the sort stable
+        {
+            tail->next = left;
+            left = left->next;
+        }
+        else
+        {
+            tail->next = right;
+            right = right->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = left != NULL ? left : right; // Appends what is left
+    while (tail->next != NULL) // Finds the end of the merged run
+    {
+        tail = tail->next;
+    }
+    *last = tail;
+    return first.next;
+}
+
+void list_sort(List list, int (*compare)(void*, void*)) // O(n log n)
+{
+    if (list->size < 2) // Already sorted
+    {
+        return;
+    }
+    for (ListIndex width = 1;; width *= 2) // Merges runs of width nodes in
+                                           // pairs
+    {
+        Node rest = list->head; // Nodes not merged yet in this pass
+        Node tail = NULL;       // Last node merged so far
+        ListIndex merges = 0;
+        while (rest != NULL)
+        {
+            Node left = rest;
+            Node right = node_split(left, width);
+            rest = node_split(right, width);
+            Node last;
+            Node first = node_merge(left, right, compare, &last);
+            if (tail == NULL) // The first merged run is the new head
+            {
+                list->head = first;
+            }
+            else
+            {
+                tail->next = first;
+            }
+            tail = last;
+            merges++;
+        }
+        list->tail = tail;
+        if (merges == 1) // A single run covers the whole list
+        {
+            break;
+        }
+    }
+    Node previousNode = NULL; // Merges only relink next, so a doubly list
+    for (Node node = list->head; list->doubly && node != NULL;
+         node = node->next) // points its nodes back in one more pass
+    {
+        node_set_previous(list, node, previousNode);
+        previousNode = node;
+    }
+    list->index_stale = true; // Index is rebuilt when next used
+    list->hash_stale = true;  // And so are the first positions, if hashed
+    finger_forget(list, 0);   // Every position may have moved
+}
+
 void list_print(List list, void (*print_element)(void* element)) // O(n)
 {
     Node node = list->head; // Receives the head address
@@ -418,7 +1405,11 @@ void list_print(List list, void (*print_element)(void* element)) // O(n)
     }
 }
 
-List list_get_sublist_between(List list, int start_idx, int end_idx) // O(n)
+List list_get_sublist_between(
+    List list,
+    ListIndex start_idx,
+    ListIndex end_idx
+) // O(n)
 {
     if (start_idx < 0 || start_idx > list_size(list) - 1 || end_idx < 0 ||
         end_idx > list_size(list) - 1) // If indices are invalid
@@ -427,12 +1418,17 @@ List list_get_sublist_between(List list, int start_idx, int end_idx) // O(n)
     }
     List newlist = list_create(); // Creates a new list
     Node node = list->head;       // Receives the address of the given list
-    for (int i = 0; i < start_idx;
+    bool indexed = index_ready(list);
+    if (indexed) // If indexed, the index jumps to start_idx
+    {
+        node = index_find(list, start_idx + 1, NULL, NULL);
+    }
+    for (ListIndex i = 0; !indexed && i < start_idx;
          i++) // Traverses to start_idx of the given list
     {
         node = node->next; // Moves to the next
     }
-    for (int i = start_idx; i <= end_idx;
+    for (ListIndex i = start_idx; i <= end_idx;
          i++) // Once at start_idx, iterate to end_idx (index offset already
               // corrected in the loop above, so <= can be used)
     {
@@ -444,14 +1440,15 @@ List list_get_sublist_between(List list, int start_idx, int end_idx) // O(n)
     return newlist; // Returns the new list
 }
 
-List list_get_sublist(List list, int indexes[], int count) // O(n)
+List list_get_sublist(List list, ListIndex indexes[], ListIndex count) // O(n)
 {
     List newlist = list_create(); // Creates the new list
     bool* index = calloc(
         list_size(list), sizeof(bool)
     ); // Creates a boolean array of list size (calloc initializes allocated
        // space to zero, which means false for booleans)
-    for (int i = 0; i < count; i++) // Traverses elements of the indexes array
+    for (ListIndex i = 0; i < count;
+         i++) // Traverses elements of the indexes array
     {
         if (indexes[i] >= 0 && indexes[i] <= list_size(list) - 1)
         {
@@ -460,9 +1457,9 @@ List list_get_sublist(List list, int indexes[], int count) // O(n)
         }
     }
     Node node = list->head; // Receives the head address
-    int j = 0; // Tracks the number of necessary passes through the list (stops
-               // once all indexed elements are found)
-    for (int i = 0; node != NULL && j < count;
+    ListIndex j = 0; // Tracks the number of necessary passes through the list
+                     // (stops once all indexed elements are found)
+    for (ListIndex i = 0; node != NULL && j < count;
          i++) // Traverses the list only as far as necessary (stops when j >=
               // count)
     {
@@ -494,6 +1491,83 @@ List list_map(List list, void* (*func)(void*)) // O(n)
     return newlist;
 }
 
+void list_map_inplace(
+    List list,
+    void* (*func)(void*),
+    void (*free_old)(void*)
+) // O(n)
+{
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        void* element = func(node->element); // Replaces it in the same node
+        if (element == node->element)         // Nothing changed
+        {
+            continue;
+        }
+        hash_index_remove(list, node->element); // Recounts it, if hashed
+        hash_index_add(list, element);
+        if (free_old != NULL) // If free_old is not NULL
+        {
+            free_old(node->element); // Cleans the replaced element
+        }
+        node->element = element;
+    }
+}
+
+void list_for_each(List list, void (*func)(void*, void*), void* ctx) // O(n)
+{
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        func(node->element, ctx);
+    }
+}
+
+void* list_reduce(
+    List list,
+    void* init,
+    void* (*fold)(void*, void*, void*),
+    void* ctx
+) // O(n)
+{
+    void* accumulated = init;
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        accumulated = fold(accumulated, node->element, ctx);
+    }
+    return accumulated;
+}
+
+bool list_any(List list, bool (*func)(void*)) // O(n)
+{
+    return list_find_if(list, func) != -1; // Stops at the first one
+}
+
+bool list_all(List list, bool (*func)(void*)) // O(n)
+{
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        if (!func(node->element)) // Stops at the first one that fails
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+ListIndex list_find_if(List list, bool (*func)(void*)) // O(n)
+{
+    ListIndex position = 0;
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        if (func(node->element)) // Stops at the first one that passes
+        {
+            return position;
+        }
+        position++;
+    }
+    return -1;
+}
+
 List list_filter(List list, bool (*func)(void*)) // O(n)
 {
     List newlist = list_create(); // Creates the list
@@ -513,6 +1587,53 @@ List list_filter(List list, bool (*func)(void*)) // O(n)
     return newlist;
 }
 
+ListIndex list_retain(
+    List list,
+    bool (*func)(void*),
+    void (*free_element)(void*)
+) // O(n)
+{
+    ListIndex removed = 0;    // Initializes removal counter
+    Node node = list->head;   // Receives the head address
+    Node previousNode = NULL; // Will be used later to track the previous node
+    while (node != NULL)      // Traverses the entire list
+    {
+        if (func(node->element)) // If it passes, it stays in the list
+        {
+            previousNode = node; // previousNode becomes the current node
+            node = node->next;   // Node advances forward
+            continue;
+        }
+        removed++;
+        if (previousNode != NULL) // If not at the head
+        {
+            previousNode->next = node->next; // Reconnects the list
+        }
+        else // If at the head
+        {
+            list->head = node->next; // Next node becomes the head
+        }
+        node_set_previous(list, node->next, previousNode); // If doubly
+        if (node->next == NULL) // If at the tail
+        {
+            list->tail = previousNode; // Previous node becomes the tail
+        }
+        hash_index_remove(list, node->element); // Before it is freed
+        if (free_element != NULL) // If free_element is not NULL
+        {
+            free_element(node->element); // Cleans the element
+        }
+        Node nextNode = node->next; // Saves the next node in a temporary
+                                    // variable
+        node_destroy(list, node);   // Frees the target node
+        node = nextNode;            // Moves to the next node
+        list->size--;               // Decrements list size
+    }
+    list->index_stale |= removed > 0; // Index is rebuilt when next used
+    finger_forget(list, 0);           // Positions may have moved
+    return removed;
+}
+
 // Iterators
 
 void list_iterator_start(List list) // O(1)
@@ -532,3 +1653,177 @@ void* list_iterator_get_next(List list) // O(1)
     list->current = list->current->next;    // Moves to the next
     return element;                         // Returns the element
 }
+
+void list_iter_init(ListIter* iter, List list) // O(1)
+{
+    iter->list = list;
+    iter->node = list->head; // Starts at the head
+    iter->offset = 0;        // Unused, a node holds a single element
+    iter->previous = NULL;   // Nothing before the head
+    iter->current = NULL;    // Nothing returned yet
+    iter->current_offset = 0;
+    iter->current_previous = NULL;
+    iter->backwards = false;
+}
+
+void list_iter_init_last(ListIter* iter, List list) // O(1)
+{
+    list_iter_init(iter, list);
+    iter->node = NULL;           // Starts past the tail
+    iter->previous = list->tail; // which comes right before it
+}
+
+bool list_iter_has_next(ListIter* iter) // O(1)
+{
+    return iter->node != NULL; // If node is not NULL, there is a next element
+}
+
+void* list_iter_next(ListIter* iter) // O(1)
+{
+    Node node = iter->node;
+    if (node == NULL) // At the end
+    {
+        return NULL;
+    }
+    iter->current_previous = iter->previous; // Remembers where it came from,
+    iter->current = node;                    // for list_iter_remove
+    iter->previous = node;
+    iter->node = node->next; // Moves to the next
+    iter->backwards = false;
+    return node->element;
+}
+
+void* list_iter_peek(ListIter* iter) // O(1)
+{
+    Node node = iter->node;
+    return node != NULL ? node->element : NULL; // Stays where it is
+}
+
+bool list_iter_has_previous(ListIter* iter) // O(1)
+{
+    return iter->previous != NULL; // If previous is not NULL, there is one
+}
+
+static Node iter_before(List list, Node node) // O(1) if doubly, O(n) otherwise
+{
+    if (list->doubly) // The node knows the one before it
+    {
+        return node_previous(node);
+    }
+    Node previousNode = NULL; // Otherwise walks from the head
+    for (Node walk = list->head; walk != node; walk = walk->next)
+    {
+        previousNode = walk;
+    }
+    return previousNode;
+}
+
+void* list_iter_previous(ListIter* iter) // O(1) if doubly, O(n) otherwise
+{
+    Node node = iter->previous;
+    if (node == NULL) // At the beginning
+    {
+        return NULL;
+    }
+    iter->node = node; // Moves back before it
+    iter->previous = iter_before(iter->list, node);
+    iter->current = node; // for list_iter_remove
+    iter->current_previous = iter->previous;
+    iter->backwards = true;
+    return node->element;
+}
+
+void* list_iter_remove(ListIter* iter) // O(1)
+{
+    Node node = iter->current;
+    if (node == NULL) // Nothing to remove
+    {
+        return NULL;
+    }
+    List list = iter->list;
+    Node previousNode = iter->current_previous;
+    if (previousNode == NULL) // If at the head
+    {
+        list->head = node->next; // Next node becomes the head
+    }
+    else
+    {
+        previousNode->next = node->next; // Reconnects the list
+    }
+    if (list->tail == node) // If at the tail
+    {
+        list->tail = previousNode; // Previous node becomes the tail
+    }
+    node_set_previous(list, node->next, previousNode); // If doubly
+    if (iter->previous == node) // The node before the next one is gone too
+    {
+        iter->previous = previousNode;
+    }
+    if (iter->node == node) // Going backwards, the next one is gone instead
+    {
+        iter->node = node->next;
+    }
+    iter->current = NULL; // Cannot be removed twice
+    void* element = node->element;
+    node_destroy(list, node);
+    list->size--;
+    hash_index_remove(list, element); // Uncounts it, if hashed
+    list->index_stale = true;         // Index is rebuilt when next used
+    list->finger = NULL;              // Its position is unknown here
+    return element;
+}
+
+static Node iter_link(ListIter* iter, Node previousNode, void* element) // O(1)
+{
+    List list = iter->list;
+    Node node = node_create(
+        list, previousNode == NULL ? list->head : previousNode->next, element
+    ); // Goes right after previousNode (at the head if NULL)
+    if (previousNode == NULL)
+    {
+        list->head = node;
+    }
+    else
+    {
+        previousNode->next = node;
+    }
+    node_set_previous(list, node, previousNode); // If doubly
+    node_set_previous(list, node->next, node);
+    if (node->next == NULL) // If it went after the tail
+    {
+        list->tail = node;
+    }
+    list->size++;
+    hash_index_add(list, element); // Counts it, if hashed
+    list->index_stale = true;      // Index is rebuilt when next used
+    list->finger = NULL;           // Its position is unknown here
+    return node;
+}
+
+void list_iter_insert_before(ListIter* iter, void* element) // O(1)
+{
+    if (iter->current == NULL || iter->backwards) // No element to go before,
+    {                                             // or it is right after the
+        list_iter_insert_after(iter, element);    // iterator anyway
+        return;
+    }
+    iter->current_previous = iter_link(iter, iter->current_previous, element);
+}
+
+void list_iter_insert_after(ListIter* iter, void* element) // O(1)
+{
+    Node node = iter_link(
+        iter, iter->previous, element
+    ); // Goes right before the next one
+    if (!iter->backwards) // And is skipped, moving forward
+    {
+        iter->previous = node;
+        return;
+    }
+    if (iter->current != NULL &&
+        iter->current == iter->node) // If it went right before current
+    {
+        iter->current_previous = node;
+    }
+    iter->node = node; // Or stays after the iterator, moving backwards
+}
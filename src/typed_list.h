@@ -0,0 +1,311 @@
+#pragma once
+
+#include "list.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/**
+ * @brief Defines a list specialized for one element type.
+ *
+ * Unlike List, the elements are stored by value inside the nodes, and the
+ * equality used by find, count_all, remove_all and remove_duplicates is
+ * expanded in place instead of being called through a function pointer, so
+ * the compiler can inline it.
+ *
+ * For example, DEFINE_LIST(IntList, int_list, int, INT_EQUAL) with
+ * #define INT_EQUAL(a, b) ((a) == (b)) defines the type IntList and the
+ * functions int_list_create, int_list_insert_last, int_list_find, ... which
+ * mirror the ones of list.h. Functions that return an element return a
+ * pointer to it inside the node (NULL if there is none), and functions that
+ * remove an element copy it to out (if not NULL) and return false if there
+ * was nothing to remove.
+ *
+ * @param Name The name of the list type.
+ * @param prefix The prefix of the function names.
+ * @param Type The element type.
+ * @param equal A function or macro taking two Type values, true iff equal.
+ */
+#define DEFINE_LIST(Name, prefix, Type, equal)                                 \
+    typedef struct Name##Node_* Name##Node;                                    \
+                                                                               \
+    struct Name##Node_                                                         \
+    {                                                                          \
+            Type element;                                                      \
+            Name##Node next;                                                   \
+    };                                                                         \
+                                                                               \
+    typedef struct Name##_* Name;                                              \
+                                                                               \
+    struct Name##_                                                             \
+    {                                                                          \
+            Name##Node head;                                                   \
+            Name##Node tail;                                                   \
+            ListIndex size;                                                    \
+            Name##Node current;                                                \
+    };                                                                         \
+                                                                               \
+    static inline Name prefix##_create()                                       \
+    {                                                                          \
+        Name list = malloc(sizeof(struct Name##_));                            \
+        list->head = NULL;                                                     \
+        list->tail = NULL;                                                     \
+        list->size = 0;                                                        \
+        list->current = NULL;                                                  \
+        return list;                                                           \
+    }                                                                          \
+                                                                               \
+    static inline void prefix##_make_empty(Name list)                          \
+    {                                                                          \
+        Name##Node node = list->head;                                          \
+        while (node != NULL)                                                   \
+        {                                                                      \
+            Name##Node previousNode = node;                                    \
+            node = node->next;                                                 \
+            free(previousNode);                                                \
+        }                                                                      \
+        list->head = NULL;                                                     \
+        list->tail = NULL;                                                     \
+        list->size = 0;                                                        \
+    }                                                                          \
+                                                                               \
+    static inline void prefix##_destroy(Name list)                             \
+    {                                                                          \
+        prefix##_make_empty(list);                                             \
+        free(list);                                                            \
+    }                                                                          \
+                                                                               \
+    static inline bool prefix##_is_empty(Name list)                            \
+    {                                                                          \
+        return list->size == 0;                                                \
+    }                                                                          \
+                                                                               \
+    static inline ListIndex prefix##_size(Name list) { return list->size; }    \
+                                                                               \
+    static inline Type* prefix##_get_first(Name list)                          \
+    {                                                                          \
+        return list->size == 0 ? NULL : &list->head->element;                  \
+    }                                                                          \
+                                                                               \
+    static inline Type* prefix##_get_last(Name list)                           \
+    {                                                                          \
+        return list->size == 0 ? NULL : &list->tail->element;                  \
+    }                                                                          \
+                                                                               \
+    static inline Type* prefix##_get(Name list, ListIndex position)            \
+    {                                                                          \
+        if (position < 0 || position > list->size - 1)                         \
+        {                                                                      \
+            return NULL;                                                       \
+        }                                                                      \
+        Name##Node node = list->head;                                          \
+        for (ListIndex i = 0; i < position; i++)                               \
+        {                                                                      \
+            node = node->next;                                                 \
+        }                                                                      \
+        return &node->element;                                                 \
+    }                                                                          \
+                                                                               \
+    static inline ListIndex prefix##_find(Name list, Type element)             \
+    {                                                                          \
+        Name##Node node = list->head;                                          \
+        for (ListIndex i = 0; node != NULL; i++)                               \
+        {                                                                      \
+            if (equal(element, node->element))                                 \
+            {                                                                  \
+                return i;                                                      \
+            }                                                                  \
+            node = node->next;                                                 \
+        }                                                                      \
+        return -1;                                                             \
+    }                                                                          \
+                                                                               \
+    static inline ListIndex prefix##_count_all(Name list, Type element)        \
+    {                                                                          \
+        ListIndex count = 0;                                                   \
+        for (Name##Node node = list->head; node != NULL; node = node->next)    \
+        {                                                                      \
+            count += equal(element, node->element) ? 1 : 0;                    \
+        }                                                                      \
+        return count;                                                          \
+    }                                                                          \
+                                                                               \
+    static inline void prefix##_insert_first(Name list, Type element)          \
+    {                                                                          \
+        Name##Node node = malloc(sizeof(struct Name##Node_));                  \
+        node->element = element;                                               \
+        node->next = list->head;                                               \
+        list->head = node;                                                     \
+        if (list->size == 0)                                                   \
+        {                                                                      \
+            list->tail = node;                                                 \
+        }                                                                      \
+        list->size++;                                                          \
+    }                                                                          \
+                                                                               \
+    static inline void prefix##_insert_last(Name list, Type element)           \
+    {                                                                          \
+        Name##Node node = malloc(sizeof(struct Name##Node_));                  \
+        node->element = element;                                               \
+        node->next = NULL;                                                     \
+        if (list->size == 0)                                                   \
+        {                                                                      \
+            list->head = node;                                                 \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            list->tail->next = node;                                           \
+        }                                                                      \
+        list->tail = node;                                                     \
+        list->size++;                                                          \
+    }                                                                          \
+                                                                               \
+    static inline void prefix##_insert(                                        \
+        Name list, Type element, ListIndex position                            \
+    )                                                                          \
+    {                                                                          \
+        if (position < 0 || position > list->size)                             \
+        {                                                                      \
+            return;                                                            \
+        }                                                                      \
+        if (position == 0)                                                     \
+        {                                                                      \
+            prefix##_insert_first(list, element);                              \
+            return;                                                            \
+        }                                                                      \
+        if (position == list->size)                                            \
+        {                                                                      \
+            prefix##_insert_last(list, element);                               \
+            return;                                                            \
+        }                                                                      \
+        Name##Node previousNode = list->head;                                  \
+        for (ListIndex i = 0; i < position - 1; i++)                           \
+        {                                                                      \
+            previousNode = previousNode->next;                                 \
+        }                                                                      \
+        Name##Node node = malloc(sizeof(struct Name##Node_));                  \
+        node->element = element;                                               \
+        node->next = previousNode->next;                                       \
+        previousNode->next = node;                                             \
+        list->size++;                                                          \
+    }                                                                          \
+                                                                               \
+    static inline bool prefix##_remove_after(                                  \
+        Name list, Name##Node previousNode, Type* out                          \
+    ) /* Removes the node after previousNode (the head if NULL) */             \
+    {                                                                          \
+        Name##Node node =                                                      \
+            previousNode == NULL ? list->head : previousNode->next;            \
+        if (out != NULL)                                                       \
+        {                                                                      \
+            *out = node->element;                                              \
+        }                                                                      \
+        if (previousNode == NULL)                                              \
+        {                                                                      \
+            list->head = node->next;                                           \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            previousNode->next = node->next;                                   \
+        }                                                                      \
+        if (list->tail == node)                                                \
+        {                                                                      \
+            list->tail = previousNode;                                         \
+        }                                                                      \
+        free(node);                                                            \
+        list->size--;                                                          \
+        return true;                                                           \
+    }                                                                          \
+                                                                               \
+    static inline bool prefix##_remove_first(Name list, Type* out)             \
+    {                                                                          \
+        if (list->size == 0)                                                   \
+        {                                                                      \
+            return false;                                                      \
+        }                                                                      \
+        return prefix##_remove_after(list, NULL, out);                         \
+    }                                                                          \
+                                                                               \
+    static inline bool prefix##_remove(                                        \
+        Name list, ListIndex position, Type* out                               \
+    )                                                                          \
+    {                                                                          \
+        if (position < 0 || position > list->size - 1)                         \
+        {                                                                      \
+            return false;                                                      \
+        }                                                                      \
+        Name##Node previousNode = NULL;                                        \
+        for (ListIndex i = 0; i < position; i++)                               \
+        {                                                                      \
+            previousNode =                                                     \
+                previousNode == NULL ? list->head : previousNode->next;        \
+        }                                                                      \
+        return prefix##_remove_after(list, previousNode, out);                 \
+    }                                                                          \
+                                                                               \
+    static inline bool prefix##_remove_last(Name list, Type* out)              \
+    {                                                                          \
+        return prefix##_remove(list, list->size - 1, out);                     \
+    }                                                                          \
+                                                                               \
+    static inline void prefix##_to_array(Name list, Type* out_array)           \
+    {                                                                          \
+        ListIndex i = 0;                                                       \
+        for (Name##Node node = list->head; node != NULL; node = node->next)    \
+        {                                                                      \
+            out_array[i++] = node->element;                                    \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    static inline ListIndex prefix##_remove_matching(                          \
+        Name list, Type element, ListIndex keep                                \
+    ) /* Removes the occurrences of element after the first keep ones */       \
+    {                                                                          \
+        ListIndex occurrences = 0;                                             \
+        Name##Node previousNode = NULL;                                        \
+        Name##Node node = list->head;                                          \
+        while (node != NULL)                                                   \
+        {                                                                      \
+            Name##Node nextNode = node->next;                                  \
+            if (equal(node->element, element) && ++occurrences > keep)         \
+            {                                                                  \
+                prefix##_remove_after(list, previousNode, NULL);               \
+            }                                                                  \
+            else                                                               \
+            {                                                                  \
+                previousNode = node;                                           \
+            }                                                                  \
+            node = nextNode;                                                   \
+        }                                                                      \
+        return occurrences;                                                    \
+    }                                                                          \
+                                                                               \
+    static inline ListIndex prefix##_remove_all(Name list, Type element)       \
+    {                                                                          \
+        return prefix##_remove_matching(list, element, 0);                     \
+    }                                                                          \
+                                                                               \
+    static inline ListIndex prefix##_remove_duplicates(                        \
+        Name list, Type element                                                \
+    )                                                                          \
+    {                                                                          \
+        return prefix##_remove_matching(list, element, 1);                     \
+    }                                                                          \
+                                                                               \
+    static inline void prefix##_iterator_start(Name list)                      \
+    {                                                                          \
+        list->current = list->head;                                            \
+    }                                                                          \
+                                                                               \
+    static inline bool prefix##_iterator_has_next(Name list)                   \
+    {                                                                          \
+        return list->current != NULL;                                          \
+    }                                                                          \
+                                                                               \
+    static inline Type* prefix##_iterator_get_next(Name list)                  \
+    {                                                                          \
+        Type* element = &list->current->element;                               \
+        list->current = list->current->next;                                   \
+        return element;                                                        \
+    }
@@ -0,0 +1,1596 @@
+#include "list.h"
+#include "hash_table.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Unrolled backend: same list.h API, but each node stores a small array of
+// elements, so traversals take one cache miss per node instead of per element
+
+#define NODE_CAPACITY 13 // With next, previous and count, a node fills two
+                         // cache lines
+
+typedef struct Node_* Node;
+
+struct Node_
+{
+        Node next;
+        Node previous; // Node before this one (NULL at the head)
+        int count;
+        bool in_chunk; // Part of a chunk, so only freed along with it
+        void* elements[NODE_CAPACITY];
+}; // Struct = struct Node_ ; Pointer = Node
+
+typedef struct Chunk_* Chunk;
+
+struct Chunk_
+{
+        Chunk next;
+        struct Node_ nodes[];
+}; // Struct = struct Chunk_ ; Pointer = Chunk
+
+struct List_
+{
+        Node head;
+        Node tail;
+        ListIndex size;
+        Node current;
+        int current_offset;    // Offset of the next element inside current
+        ListIndex chunk_nodes; // Nodes per chunk (0 means one per malloc)
+        ListIndex chunk_used;  // Nodes already carved from the newest chunk
+        Chunk chunks;          // Chunks owned by the list (newest first)
+        Chunk chunks_last;     // Oldest chunk, so splices append in O(1)
+        Node free_nodes;       // Released nodes, chained through next
+        Node free_last;        // Last of them (if free_nodes is not NULL)
+        ListIndex malloc_nodes; // Nodes allocated one by one (not in chunks)
+        Node finger;               // Node used by the last list_get (or NULL)
+        ListIndex finger_position; // Position of its first element
+        HashTable hash_index; // Occurrences of each element (or NULL)
+        bool (*hash_equal)(void*, void*); // Equality used by hash_index
+        bool hash_stale; // First positions in hash_index must be rebuilt
+        size_t hash_base; // Added to them, so changes at the head move them
+                          // all in O(1) (wrapping around)
+}; // Struct = struct List_ ; Pointer = List
+
+static Node node_create(List list, Node previous, Node next) // O(1)
+{
+    Node node;
+    if (list->free_nodes != NULL) // If a released node can be reused
+    {
+        node = list->free_nodes;       // Takes it from the free list
+        list->free_nodes = node->next; // Advances the free list
+    }
+    else if (list->chunk_nodes == 0) // If the list is not pooled
+    {
+        node = malloc(sizeof(struct Node_)); // Allocates memory for the node
+        node->in_chunk = false;
+        list->malloc_nodes++;
+    }
+    else // Otherwise carves the node from the newest chunk
+    {
+        if (list->chunks == NULL ||
+            list->chunk_used == list->chunk_nodes) // If the chunk is exhausted
+        {
+            Chunk chunk = malloc(
+                sizeof(struct Chunk_) +
+                list->chunk_nodes * sizeof(struct Node_)
+            );                          // Allocates a whole chunk at once
+            chunk->next = list->chunks; // Chains it before the older ones
+            if (list->chunks == NULL)   // The first one is also the oldest
+            {
+                list->chunks_last = chunk;
+            }
+            list->chunks = chunk; // Becomes the newest chunk
+            list->chunk_used = 0;       // Nothing carved from it yet
+        }
+        node = &list->chunks->nodes[list->chunk_used++]; // Next unused node
+        node->in_chunk = true;
+    }
+    node->next = next;         // Assigns next address
+    node->previous = previous; // And previous address
+    node->count = 0;           // Starts without elements
+    if (next != NULL)          // The node goes right before next, so next
+    {                          // points back to it (previous->next is left
+        next->previous = node; // to the caller)
+    }
+    return node;
+}
+
+static void node_destroy(List list, Node node) // O(1)
+{
+    if (!node->in_chunk) // If it was allocated on its own
+    {
+        free(node); // Gives the node back to the allocator
+        list->malloc_nodes--;
+        return;
+    }
+    if (list->free_nodes == NULL) // Otherwise pushes it onto the free list
+    {                             // (its chunk is only freed by list_wipe)
+        list->free_last = node;
+    }
+    node->next = list->free_nodes;
+    list->free_nodes = node;
+}
+
+static void node_insert_at(Node node, int offset, void* element) // O(1)
+{
+    memmove(
+        &node->elements[offset + 1],
+        &node->elements[offset],
+        (node->count - offset) * sizeof(void*)
+    );                                // Shifts the following elements right
+    node->elements[offset] = element; // Stores the element in the gap
+    node->count++;                    // One more element in the node
+    // O(1) because a node never holds more than NODE_CAPACITY elements
+}
+
+static void* node_remove_at(Node node, int offset) // O(1)
+{
+    void* element = node->elements[offset]; // Saves the element address
+    node->count--;                          // One less element in the node
+    memmove(
+        &node->elements[offset],
+        &node->elements[offset + 1],
+        (node->count - offset) * sizeof(void*)
+    ); // Shifts the following elements left, closing the gap
+    return element;
+}
+
+static void node_settle(List list, Node previousNode, Node node) // O(1)
+{
+    if (node->count == 0) // If the node became empty, it leaves the list
+    {
+        if (previousNode == NULL) // If it is the head
+        {
+            list->head = node->next; // Next node becomes the head
+        }
+        else
+        {
+            previousNode->next = node->next; // Reconnects the list
+        }
+        if (node->next != NULL) // The next node points back past it
+        {
+            node->next->previous = previousNode;
+        }
+        if (list->tail == node) // If it is the tail
+        {
+            list->tail = previousNode; // Previous node becomes the tail
+        }
+        node_destroy(list, node); // Frees the node
+        return;
+    }
+    Node nextNode = node->next;
+    if (nextNode != NULL &&
+        node->count + nextNode->count <=
+            NODE_CAPACITY) // If both fit in one node, merges them to keep the
+                           // nodes dense
+    {
+        memcpy(
+            &node->elements[node->count],
+            nextNode->elements,
+            nextNode->count * sizeof(void*)
+        );                              // Appends the next node's elements
+        node->count += nextNode->count; // Updates the count
+        node->next = nextNode->next;    // Skips the merged node
+        if (node->next != NULL)         // Which the next node skips too
+        {
+            node->next->previous = node;
+        }
+        if (list->tail == nextNode)     // If the merged node was the tail
+        {
+            list->tail = node; // This node becomes the tail
+        }
+        node_destroy(list, nextNode); // Frees the merged node
+    }
+}
+
+static Node node_at(List list, ListIndex* offset) // O(n)
+{
+    Node node = list->head;        // Starts at the head
+    while (*offset >= node->count) // Skips whole nodes before the position
+    {
+        *offset -= node->count; // Discounts the skipped elements
+        node = node->next;      // Moves forward
+    }
+    return node; // *offset is now the position inside the node
+}
+
+static void finger_forget(List list, ListIndex position) // O(1)
+{
+    if (list->finger != NULL &&
+        position <= list->finger_position) // If the change happened at or
+                                           // before the finger, it is lost
+    {
+        list->finger = NULL;
+    }
+}
+
+static Node pool_take(List list, ListIndex count) // O(1)
+{
+    if (list->chunks != NULL &&
+        list->chunk_nodes - list->chunk_used >=
+            count) // If the newest chunk has room, carves them all from it
+    {
+        Node nodes = &list->chunks->nodes[list->chunk_used];
+        list->chunk_used += count;
+        return nodes;
+    }
+    Chunk chunk = malloc(sizeof(struct Chunk_) + count * sizeof(struct Node_));
+    if (list->chunks != NULL) // Otherwise one chunk just for them, behind the
+    {                         // newest chunk, which chunk_used refers to
+        chunk->next = list->chunks->next;
+        list->chunks->next = chunk;
+        if (chunk->next == NULL) // Behind the only chunk, so the oldest
+        {
+            list->chunks_last = chunk;
+        }
+    }
+    else // Or the only chunk, already exhausted
+    {
+        chunk->next = NULL;
+        list->chunks = chunk;
+        list->chunks_last = chunk;
+        list->chunk_used = list->chunk_nodes;
+    }
+    return chunk->nodes;
+}
+
+static ListIndex hash_index_stored(List list, ListIndex position) // O(1)
+{
+    return (ListIndex)((size_t)position - list->hash_base); // Wraps around
+}                                                            // like hash_base
+
+static void hash_index_prepend(List list, void* element) // O(1), at the head
+{
+    if (list->hash_index != NULL) // Only if a hash index is attached
+    {
+        sll_hash_table_add(list->hash_index, element);
+        list->hash_base++; // Every recorded position moves one forward
+        sll_hash_table_set_first(
+            list->hash_index, element, hash_index_stored(list, 0)
+        ); // And its first occurrence is now this one
+    }
+}
+
+static void hash_index_remove_first(List list, void* element) // O(1)
+{
+    if (list->hash_index != NULL) // Only if a hash index is attached
+    {
+        list->hash_base--; // Every recorded position moves one back
+        if (sll_hash_table_remove(list->hash_index, element) >
+            0) // Its next occurrence, wherever it is, becomes the first
+        {
+            list->hash_stale = true;
+        }
+    }
+}
+
+static void hash_index_remove_last(List list, void* element) // O(1)
+{
+    if (list->hash_index != NULL) // No position moves, and if the element
+    {                             // occurs again, its first one is earlier
+        sll_hash_table_remove(list->hash_index, element);
+    }
+}
+
+static void hash_index_add(List list, void* element) // O(1)
+{
+    if (list->hash_index != NULL) // Only if a hash index is attached
+    {
+        sll_hash_table_add(list->hash_index, element);
+        list->hash_stale = true; // Later positions moved
+    }
+}
+
+static void hash_index_append(
+    List list,
+    void* element,
+    ListIndex position
+) // O(1), for an element inserted at the end
+{
+    if (list->hash_index != NULL &&
+        sll_hash_table_add(list->hash_index, element) == 1 &&
+        !list->hash_stale) // Nothing moved, and a new element's first
+    {                      // occurrence is this one
+        sll_hash_table_set_first(
+            list->hash_index, element, hash_index_stored(list, position)
+        );
+    }
+}
+
+static void hash_index_remove(List list, void* element) // O(1)
+{
+    if (list->hash_index != NULL) // Only if a hash index is attached
+    {
+        sll_hash_table_remove(list->hash_index, element);
+        list->hash_stale = true; // Later positions moved
+    }
+}
+
+static void hash_index_rebuild(List list) // O(n)
+{
+    sll_hash_table_forget_firsts(list->hash_index);
+    list->hash_base = 0; // Recorded positions are the real ones again
+    ListIndex position = 0;
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            if (sll_hash_table_first(list->hash_index, node->elements[i]) ==
+                -1) // Only the first occurrence of each element is recorded
+            {
+                sll_hash_table_set_first(
+                    list->hash_index, node->elements[i], position + i
+                );
+            }
+        }
+        position += node->count;
+    }
+    list->hash_stale = false;
+}
+
+static bool hash_index_answers(List list, bool (*equal)(void*, void*)) // O(1)
+{
+    return list->hash_index != NULL &&
+           list->hash_equal == equal; // The index only knows its own equality
+}
+
+List list_create() // O(1)
+{
+    return list_create_pooled(0); // Without chunks, each node is a malloc
+}
+
+List list_create_doubly() // O(1)
+{
+    return list_create(); // Nodes here always point back
+}
+
+List list_create_pooled(ListIndex chunk_nodes) // O(1)
+{
+    List list = malloc(sizeof(struct List_)); // Allocates memory for the list
+    list->head = NULL;                        // Sets head to NULL
+    list->tail = NULL;                        // Sets tail to NULL
+    list->size = 0;                           // Sets size to 0
+    list->current = NULL;                     // Iterator not started
+    list->current_offset = 0;
+    list->chunk_nodes =
+        chunk_nodes > 0 ? (chunk_nodes + NODE_CAPACITY - 1) / NODE_CAPACITY
+                        : 0; // chunk_nodes counts elements, rounded up to
+                             // whole nodes
+    list->chunk_used = 0;    // No chunk yet
+    list->chunks = NULL;     // No chunks yet
+    list->chunks_last = NULL;
+    list->free_nodes = NULL; // Nothing released
+    list->free_last = NULL;
+    list->malloc_nodes = 0;
+    list->finger = NULL;     // No list_get yet
+    list->finger_position = 0;
+    list->hash_index = NULL; // No hash index
+    list->hash_equal = NULL;
+    list->hash_stale = false;
+    list->hash_base = 0;
+    return list;
+}
+
+void list_wipe(List list, void (*free_element)(void*)) // O(n)
+{
+    Node node = list->head; // Gets node address from head
+    while (node != NULL &&
+           (free_element != NULL ||
+            list->malloc_nodes > 0)) // Nodes in chunks only need a traversal
+                                     // if their elements are freed
+    {
+        if (free_element != NULL) // Not every element needs cleanup
+        {
+            for (int i = 0; i < node->count; i++)
+            {
+                free_element(node->elements[i]); // Cleans the element
+            }
+        }
+        Node previousNode = node; // Saves the old node
+        node = node->next;        // Advances to the next
+        if (!previousNode->in_chunk)
+        {
+            free(previousNode); // Cleans the old node
+        }
+    }
+    list->malloc_nodes = 0;
+    while (list->chunks != NULL) // Pooled nodes go away chunk by chunk
+    {
+        Chunk chunk = list->chunks; // Saves the chunk
+        list->chunks = chunk->next; // Advances to the older one
+        free(chunk);                // Cleans every node inside it
+    }
+    list->chunk_used = 0;    // Next node_create starts a fresh chunk
+    list->free_nodes = NULL; // Released nodes lived in the freed chunks
+}
+
+void list_destroy(List list, void (*free_element)(void*)) // O(n)
+{
+    list_set_hash_index(list, NULL, NULL); // Cleans the hash index, if any
+    list_wipe(list, free_element); // Cleans the nodes and elements of the list
+    free(list);                    // Finally, cleans the list
+}
+
+void list_set_hash_index(
+    List list,
+    size_t (*hash)(void*),
+    bool (*equal)(void*, void*)
+) // O(n)
+{
+    if (list->hash_index != NULL) // Drops the current one, if any
+    {
+        sll_hash_table_destroy(list->hash_index);
+        list->hash_index = NULL;
+        list->hash_equal = NULL;
+    }
+    if (hash == NULL) // No new one
+    {
+        return;
+    }
+    list->hash_index = sll_hash_table_create(hash, equal);
+    list->hash_equal = equal;
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        for (int i = 0; i < node->count; i++) // Counts them all
+        {
+            sll_hash_table_add(list->hash_index, node->elements[i]);
+        }
+    }
+    list->hash_stale = true; // Positions are recorded on the first list_find
+}
+
+void list_set_indexed(List list, bool indexed) // O(1)
+{
+    (void)list;    // Positional walks already skip whole nodes, so this
+    (void)indexed; // backend does not keep a positional index
+}
+
+bool list_is_empty(List list) // O(1)
+{
+    return list->size == 0;
+}
+
+ListIndex list_size(List list) // O(1)
+{
+    return list->size;
+}
+
+void* list_get_first(List list) // O(1)
+{
+    if (list_is_empty(list)) // If the list is empty
+    {
+        return NULL; // (i.e., no element is defined)
+    }
+    return list->head->elements[0];
+}
+
+void* list_get_last(List list) // O(1)
+{
+    if (list_is_empty(list)) // If the list is empty
+    {
+        return NULL; // (i.e., no element is defined)
+    }
+    return list->tail->elements[list->tail->count - 1];
+}
+
+void* list_get(List list, ListIndex position) // O(n)
+{
+    if (position > list_size(list) - 1 ||
+        position < 0) // Cannot access positions that do not exist
+    {
+        return NULL;
+    }
+    Node node = list->head; // Walks node by node
+    ListIndex first = 0;    // Position of the node's first element
+    if (list->finger != NULL &&
+        list->finger_position <= position) // Resumes from the last list_get
+    {
+        node = list->finger;
+        first = list->finger_position;
+    }
+    while (position - first >= node->count) // Skips whole nodes
+    {
+        first += node->count;
+        node = node->next;
+    }
+    list->finger = node;           // Remembers it, so a loop over the
+    list->finger_position = first; // positions is O(n), not O(n^2)
+    return node->elements[position - first];
+}
+
+ListIndex list_find(
+    List list,
+    bool (*equal)(void*, void*),
+    void* element
+) // O(n), or O(1) if hashed (plus O(n) once after a change that moved it)
+{
+    if (hash_index_answers(list, equal)) // The hash index knows whether it
+    {                                    // occurs, and its first position
+        if (sll_hash_table_count(list->hash_index, element) == 0)
+        {
+            return -1;
+        }
+        if (list->hash_stale) // Positions moved since they were recorded
+        {
+            hash_index_rebuild(list);
+        }
+        return (ListIndex)((size_t)sll_hash_table_first(
+                               list->hash_index, element
+                           ) +
+                           list->hash_base);
+    }
+    ListIndex position = 0; // Position of the node's first element
+    Node node = list->head; // Node receives head address
+    while (node != NULL)    // Traverses from first to last node
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            if (equal(element, node->elements[i])) // If elements are equal
+            {
+                return position + i; // Returns position
+            }
+        }
+        position += node->count; // Skips the node's elements
+        node = node->next;       // Node receives the next address
+    }
+    return -1;
+}
+
+void list_insert_first(List list, void* element) // O(1)
+{
+    if (list->head == NULL ||
+        list->head->count == NODE_CAPACITY) // If there is no room at the head
+    {
+        list->head = node_create(list, NULL, list->head); // Creates a head
+        if (list->tail == NULL)                     // If the list was empty
+        {
+            list->tail = list->head; // Tail also receives the node
+        }
+    }
+    node_insert_at(list->head, 0, element); // Inserts before the others
+    list->size++;                           // Increments list size
+    finger_forget(list, 0);                 // Every position moved
+    hash_index_prepend(list, element);      // Counts it, if hashed
+}
+
+void list_insert_last(List list, void* element) // O(1)
+{
+    if (list->tail == NULL ||
+        list->tail->count == NODE_CAPACITY) // If there is no room at the tail
+    {
+        Node node = node_create(list, list->tail, NULL); // Creates a node
+        if (list->tail == NULL)              // If the list is empty
+        {
+            list->head = node; // Head also receives the node
+        }
+        else // Otherwise
+        {
+            list->tail->next = node; // Tail's next points to node
+        }
+        list->tail = node; // Node becomes the new tail
+    }
+    list->tail->elements[list->tail->count++] = element; // Appends
+    list->size++;                                        // Increments size
+    hash_index_append(list, element, list->size - 1);    // Counts it, if any
+}
+
+void list_insert_last_bulk(List list, void** array, ListIndex count) // O(n)
+{
+    if (count <= 0) // Nothing to insert
+    {
+        return;
+    }
+    int room = list->tail != NULL ? NODE_CAPACITY - list->tail->count : 0;
+    ListIndex copied = count < room ? count : room; // Fills the tail first
+    if (copied > 0)
+    {
+        memcpy(
+            &list->tail->elements[list->tail->count],
+            array,
+            copied * sizeof(void*)
+        );
+        list->tail->count += copied;
+    }
+    ListIndex remaining = count - copied;
+    ListIndex needed = (remaining + NODE_CAPACITY - 1) / NODE_CAPACITY;
+    Node nodes = needed > 0 ? pool_take(list, needed) : NULL; // Contiguous
+    for (ListIndex i = 0; i < needed; i++) // Then whole new nodes, linked in
+    {                                      // one pass
+        Node node = &nodes[i];
+        node->in_chunk = true;
+        ListIndex left = remaining - i * NODE_CAPACITY;
+        node->count = left < NODE_CAPACITY ? (int)left : NODE_CAPACITY;
+        memcpy(
+            node->elements,
+            &array[copied + i * NODE_CAPACITY],
+            node->count * sizeof(void*)
+        );
+        node->next = NULL;
+        node->previous = list->tail;
+        if (list->tail == NULL) // If the list was empty
+        {
+            list->head = node; // First one becomes the head
+        }
+        else
+        {
+            list->tail->next = node;
+        }
+        list->tail = node;
+    }
+    for (ListIndex i = 0; i < count; i++)
+    {
+        hash_index_append(list, array[i], list->size + i); // If hashed
+    }
+    list->size += count;
+}
+
+List list_from_array(void** array, ListIndex count) // O(n)
+{
+    List list = list_create();                 // Not pooled, but its nodes
+    list_insert_last_bulk(list, array, count); // are one chunk of exactly
+                                               // the nodes needed
+    return list;
+}
+
+void list_insert(List list, void* element, ListIndex position) // O(n)
+{
+    if (position < 0 ||
+        position >
+            list_size(list)) // Cannot insert at positions that do not exist
+    {
+        return;
+    }
+    if (position ==
+        0) // If position is head, inserts at the beginning and returns
+    {
+        list_insert_first(list, element);
+        return;
+    }
+    if (position ==
+        list_size(list)) // If position is tail, inserts at the end and returns
+    {
+        list_insert_last(list, element);
+        return;
+    }
+    finger_forget(list, position);        // Positions from here on move
+    Node node = node_at(list, &position); // Node holding the position
+    if (node->count == NODE_CAPACITY)     // If the node is full, splits it
+    {
+        int moved = node->count / 2;               // Upper half moves
+        Node half = node_create(list, node, node->next); // to a new node
+        memcpy(
+            half->elements,
+            &node->elements[node->count - moved],
+            moved * sizeof(void*)
+        );                   // Copies the upper half
+        half->count = moved; // Updates both counts
+        node->count -= moved;
+        node->next = half;      // New node goes right after this one
+        if (list->tail == node) // If the split node was the tail
+        {
+            list->tail = half; // The new node becomes the tail
+        }
+        if (position > node->count) // If the position moved to the new node
+        {
+            position -= node->count; // Adjusts it to the new node
+            node = half;
+        }
+    }
+    node_insert_at(node, position, element); // There is room now
+    list->size++;                            // Increases list size
+    hash_index_add(list, element);           // Counts it, if hashed
+}
+
+void* list_remove_first(List list) // O(1)
+{
+    if (list_is_empty(list)) // If the list is empty
+    {
+        return NULL; // Returns no element
+    }
+    finger_forget(list, 0);                        // Every position moved
+    void* element = node_remove_at(list->head, 0); // Removes from the head
+    node_settle(list, NULL, list->head); // Drops or merges the head node
+    list->size--;                        // Decrements list size
+    hash_index_remove_first(list, element); // Uncounts it, if hashed
+    return element;                         // Returns the element address
+}
+
+void* list_remove_last(List list) // O(1)
+{
+    if (list_is_empty(list)) // If the list is empty
+    {
+        return NULL; // Returns no element
+    }
+    finger_forget(list, list->size - 1);           // Only if on the tail
+    Node tail = list->tail;                        // Saves the tail node
+    void* element = tail->elements[--tail->count]; // Removes its last element
+    list->size--;                                  // Decrements list size
+    hash_index_remove_last(list, element);         // Uncounts it, if hashed
+    if (tail->count == 0) // If the tail emptied, it leaves the list
+    {
+        node_settle(list, tail->previous, tail); // No walk to find the node
+    }                                            // before it
+    return element; // Returns element
+}
+
+void* list_remove(List list, ListIndex position) // O(n)
+{
+    if (position < 0 || position > list_size(list) - 1 ||
+        list_is_empty(list)) // Does not return or remove any address that does
+                             // not exist in the list
+    {
+        return NULL;
+    }
+    finger_forget(list, position);  // Positions from here on move
+    Node previousNode = NULL;       // Tracks the node before the one found
+    Node node = list->head;         // Starts at the head
+    while (position >= node->count) // Skips whole nodes before the position
+    {
+        position -= node->count; // Discounts the skipped elements
+        previousNode = node;     // Saves the previous node
+        node = node->next;       // Moves forward
+    }
+    void* element = node_remove_at(node, position); // Removes the element
+    node_settle(list, previousNode, node); // Drops or merges the node
+    list->size--;                          // Decrements list size
+    hash_index_remove(list, element);      // Uncounts it, if hashed
+    return element;                        // Returns element
+}
+
+void list_make_empty(List list, void (*free_element)(void*)) // O(n)
+{
+    list_wipe(list, free_element); // Cleans the nodes and elements of the list
+    list->head = NULL;             // Resets everything to initial state
+    list->tail = NULL;
+    list->size = 0;
+    list->finger = NULL;
+    if (list->hash_index != NULL) // An empty list has an empty hash index
+    {
+        sll_hash_table_clear(list->hash_index);
+    }
+    list->hash_stale = false; // No positions to record
+    list->hash_base = 0;
+}
+
+void list_to_array(List list, void** out_array)
+{
+    Node node = list->head; // Receives the head address
+    while (node != NULL)    // Traverses from first node until null
+    {
+        memcpy(
+            out_array, node->elements, node->count * sizeof(void*)
+        );                        // Copies the whole node at once
+        out_array += node->count; // Moves past the copied elements
+        node = node->next;        // Advances to the next
+    }
+}
+
+ListIndex list_count_all(
+    List list,
+    bool (*equal)(void*, void*),
+    void* element
+) // O(n)
+{
+    if (hash_index_answers(list, equal)) // The hash index already knows
+    {
+        return sll_hash_table_count(list->hash_index, element);
+    }
+    Node node = list->head; // Receives the head address
+    ListIndex count = 0;    // Sets counter to 0
+    while (node != NULL)    // Traverses from first to last node
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            if (equal(element, node->elements[i])) // If equal
+            {
+                count++; // Increments counter
+            }
+        }
+        node = node->next; // Advances in the list
+    }
+    return count; // Returns the counter
+}
+
+ListIndex list_remove_matching(
+    List list,
+    bool (*equal_element)(void*, void*),
+    void (*free_element)(void*),
+    void* element,
+    int keep
+) // O(n)
+{
+    if (hash_index_answers(list, equal_element) &&
+        sll_hash_table_count(list->hash_index, element) <=
+            keep) // If the hash index knows there is nothing to remove
+    {
+        return sll_hash_table_count(list->hash_index, element);
+    }
+    ListIndex occurrences = 0; // Initializes occurrence counter
+    Node node = list->head;    // Receives the head address
+    Node previousNode = NULL;  // Last node that kept elements
+    finger_forget(list, 0);    // Positions may move
+    while (node != NULL)       // Traverses the entire list
+    {
+        int kept = 0; // Elements kept in this node, compacted to the front
+        for (int i = 0; i < node->count; i++)
+        {
+            if (equal_element(node->elements[i], element) &&
+                ++occurrences > keep) // If equal and past the kept ones
+            {
+                hash_index_remove(list, node->elements[i]); // Before freeing
+                if (free_element != NULL) // If free_element is not NULL
+                {
+                    free_element(node->elements[i]); // Cleans the element
+                }
+            }
+            else
+            {
+                node->elements[kept++] = node->elements[i]; // Keeps it
+            }
+        }
+        list->size -= node->count - kept; // Discounts the removed ones
+        node->count = kept;
+        Node nextNode = node->next; // Saves the next node
+        if (kept == 0)              // If nothing was kept, the node leaves
+        {
+            node_settle(list, previousNode, node);
+        }
+        else
+        {
+            previousNode = node; // previousNode becomes the current node
+        }
+        node = nextNode; // Node advances forward
+    }
+    return occurrences;
+}
+
+ListIndex list_remove_all(
+    List list,
+    bool (*equal_element)(void*, void*),
+    void (*free_element)(void*),
+    void* element
+) // O(n)
+{
+    return list_remove_matching(
+        list, equal_element, free_element, element, 0
+    ); // Keeps none of the occurrences
+}
+
+ListIndex list_remove_duplicates(
+    List list,
+    bool (*equal_element)(void*, void*),
+    void (*free_element)(void*),
+    void* element
+) // O(n)
+{
+    return list_remove_matching(
+        list, equal_element, free_element, element, 1
+    ); // Keeps only the first occurrence
+}
+
+ListIndex list_unique(
+    List list,
+    size_t (*hash)(void*),
+    bool (*equal_element)(void*, void*),
+    void (*free_element)(void*)
+) // O(n)
+{
+    HashTable seen = sll_hash_table_create(hash, equal_element);
+    sll_hash_table_reserve(seen, list->size); // Never grows during the pass
+    ListIndex removed = 0;    // Initializes removal counter
+    Node node = list->head;   // Receives the head address
+    Node previousNode = NULL; // Last node that kept elements
+    finger_forget(list, 0);   // Positions may move
+    while (node != NULL)      // Traverses the entire list
+    {
+        int kept = 0; // Elements kept in this node, compacted to the front
+        for (int i = 0; i < node->count; i++)
+        {
+            if (sll_hash_table_add(seen, node->elements[i]) ==
+                1) // The first occurrence stays in the list
+            {
+                node->elements[kept++] = node->elements[i]; // Keeps it
+                continue;
+            }
+            hash_index_remove(list, node->elements[i]); // Before freeing
+            if (free_element != NULL) // If free_element is not NULL
+            {
+                free_element(node->elements[i]); // Cleans the element
+            }
+        }
+        removed += node->count - kept;
+        list->size -= node->count - kept; // Discounts the removed ones
+        node->count = kept;
+        Node nextNode = node->next; // Saves the next node
+        if (kept == 0)              // If nothing was kept, the node leaves
+        {
+            node_settle(list, previousNode, node);
+        }
+        else
+        {
+            previousNode = node; // previousNode becomes the current node
+        }
+        node = nextNode; // Node advances forward
+    }
+    sll_hash_table_destroy(seen);
+    return removed;
+}
+
+List list_join(List list1, List list2) // O(n)
+{
+    List list = list_create(); // Creates the new list
+    Node node = list1->head;   // Node receives head address of list 1
+    while (node != NULL) // Traverses list 1 adding elements to the new list
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            list_insert_last(list, node->elements[i]); // Inserts element
+        }
+        node = node->next; // Moves to the next
+    }
+    node = list2->head;  // Node receives head address of list 2
+    while (node != NULL) // Traverses list 2 adding elements to the new list
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            list_insert_last(list, node->elements[i]); // Inserts element
+        }
+        node = node->next; // Moves to the next
+    }
+    return list;
+}
+
+void list_splice(List list1, List list2) // O(1)
+{
+    if (list1 == list2 || list_is_empty(list2)) // Nothing to move
+    {
+        return;
+    }
+    if (list2->chunks != NULL) // Nodes in chunks move along with them, even
+    {                          // if only one of the lists is pooled
+        if (list1->chunks != NULL) // Keeps list1's newest chunk first, since
+        {                          // chunk_used refers to it
+            list2->chunks_last->next = list1->chunks->next;
+            list1->chunks->next = list2->chunks;
+            if (list2->chunks_last->next == NULL) // list1 had one chunk
+            {
+                list1->chunks_last = list2->chunks_last;
+            }
+        }
+        else // list2's newest chunk may have another size, so it counts
+        {    // as exhausted
+            list1->chunks = list2->chunks;
+            list1->chunks_last = list2->chunks_last;
+            list1->chunk_used = list1->chunk_nodes;
+        }
+    }
+    if (list2->free_nodes != NULL) // Its released nodes are reused by list1
+    {
+        list2->free_last->next = list1->free_nodes;
+        if (list1->free_nodes == NULL)
+        {
+            list1->free_last = list2->free_last;
+        }
+        list1->free_nodes = list2->free_nodes;
+    }
+    if (list_is_empty(list1)) // Links list2's nodes after list1's tail
+    {
+        list1->head = list2->head;
+    }
+    else
+    {
+        list1->tail->next = list2->head;
+    }
+    list2->head->previous = list1->tail; // NULL if list1 was empty
+    list1->tail = list2->tail;
+    list1->size += list2->size;
+    list1->malloc_nodes += list2->malloc_nodes;
+    for (Node node = list2->head; list1->hash_index != NULL && node != NULL;
+         node = node->next) // A hash index must count every moved element,
+    {                       // which costs O(m)
+        for (int i = 0; i < node->count; i++)
+        {
+            sll_hash_table_add(list1->hash_index, node->elements[i]);
+        }
+        list1->hash_stale = true;
+    }
+    if (list2->hash_index != NULL)
+    {
+        sll_hash_table_clear(list2->hash_index);
+    }
+    list2->head = NULL; // list2 is left empty, ready to be reused
+    list2->tail = NULL;
+    list2->size = 0;
+    list2->current = NULL;
+    list2->finger = NULL;
+    list2->chunks = NULL;     // Its chunks and released nodes now belong
+    list2->free_nodes = NULL; // to list1
+    list2->chunk_used = 0;
+    list2->malloc_nodes = 0;
+}
+
+static void elements_merge(
+    void** left,
+    size_t leftCount,
+    void** right,
+    size_t rightCount,
+    void** out,
+    int (*compare)(void*, void*)
+) // O(n)
+{
+    size_t i = 0, j = 0;
+    while (i < leftCount && j < rightCount) // Takes the smaller one each time
+    {
+        if (compare(left[i], right[j]) <=
+            0) // On ties, left first, which keeps the sort stable
+        {
+            *out++ = left[i++];
+        }
+        else
+        {
+            *out++ = right[j++];
+        }
+    }
+    memcpy(out, &left[i], (leftCount - i) * sizeof(void*)); // Appends what
+    out += leftCount - i;                                    // is left
+    memcpy(out, &right[j], (rightCount - j) * sizeof(void*));
+}
+
+void list_sort(List list, int (*compare)(void*, void*)) // O(n log n)
+{
+    size_t size = list->size;
+    if (size < 2) // Already sorted
+    {
+        return;
+    }
+    void** from = malloc(2 * size * sizeof(void*)); // The elements are sorted
+    void** to = from + size;                         // inside the nodes, so
+    list_to_array(list, from);                       // only pointers move
+    for (size_t width = 1; width < size; width *= 2) // Merges runs of width
+    {                                                // elements in pairs
+        for (size_t start = 0; start < size; start += 2 * width)
+        {
+            size_t middle = start + width < size ? start + width : size;
+            size_t end = middle + width < size ? middle + width : size;
+            elements_merge(
+                &from[start],
+                middle - start,
+                &from[middle],
+                end - middle,
+                &to[start],
+                compare
+            );
+        }
+        void** swap = from; // The merged runs are the input of the next pass
+        from = to;
+        to = swap;
+    }
+    void** sorted = from;
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        memcpy(
+            node->elements, sorted, node->count * sizeof(void*)
+        );                     // Refills each node in order
+        sorted += node->count; // Moves past the copied elements
+    }
+    free(from < to ? from : to); // The start of the allocation
+    list->hash_stale = true;     // First positions are rebuilt, if hashed
+    finger_forget(list, 0);      // Every position may have moved
+}
+
+void list_print(List list, void (*print_element)(void* element)) // O(n)
+{
+    Node node = list->head; // Receives the head address
+    while (node != NULL)    // Traverses the entire list
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            print_element(node->elements[i]); // Prints the element
+        }
+        node = node->next; // Moves to the next
+    }
+}
+
+List list_get_sublist_between(
+    List list,
+    ListIndex start_idx,
+    ListIndex end_idx
+) // O(n)
+{
+    if (start_idx < 0 || start_idx > list_size(list) - 1 || end_idx < 0 ||
+        end_idx > list_size(list) - 1) // If indices are invalid
+    {
+        return NULL;
+    }
+    List newlist = list_create();       // Creates a new list
+    ListIndex offset = start_idx;       // Offset inside the first node
+    Node node = node_at(list, &offset); // Skips to start_idx node by node
+    for (ListIndex i = start_idx; i <= end_idx; i++) // Copies up to end_idx
+    {
+        if (offset == node->count) // If the node is exhausted
+        {
+            node = node->next; // Moves to the next
+            offset = 0;
+        }
+        list_insert_last(
+            newlist, node->elements[offset++]
+        ); // Inserts current element into the new list
+    }
+    return newlist; // Returns the new list
+}
+
+List list_get_sublist(List list, ListIndex indexes[], ListIndex count) // O(n)
+{
+    List newlist = list_create(); // Creates the new list
+    bool* index = calloc(
+        list_size(list), sizeof(bool)
+    ); // Boolean array of list size (calloc initializes it to false)
+    for (ListIndex i = 0; i < count;
+         i++) // Traverses elements of the indexes array
+    {
+        if (indexes[i] >= 0 && indexes[i] <= list_size(list) - 1)
+        {
+            index[indexes[i]] = true; // Marks each position to include
+        }
+    }
+    ListIndex position = 0; // Position of the node's first element
+    Node node = list->head; // Receives the head address
+    ListIndex j = 0;        // Stops once all indexed elements are found
+    while (node != NULL && j < count)
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            if (index[position + i]) // If the position was requested
+            {
+                list_insert_last(newlist, node->elements[i]); // Adds it
+                j++;                                          // Increments j
+            }
+        }
+        position += node->count; // Skips the node's elements
+        node = node->next;       // Moves forward
+    }
+    free(index);    // Frees the boolean array
+    return newlist; // Returns the new list
+}
+
+List list_map(List list, void* (*func)(void*)) // O(n)
+{
+    List newlist = list_create(); // Creates a new list
+    Node node = list->head;       // Receives the head address
+    while (node != NULL)          // Traverses the entire list
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            list_insert_last(
+                newlist, func(node->elements[i])
+            ); // Inserts the element modified by the function
+        }
+        node = node->next; // Moves to the next
+    }
+    return newlist;
+}
+
+void list_map_inplace(
+    List list,
+    void* (*func)(void*),
+    void (*free_old)(void*)
+) // O(n)
+{
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            void* element = func(node->elements[i]); // Replaces it in place
+            if (element == node->elements[i])         // Nothing changed
+            {
+                continue;
+            }
+            hash_index_remove(list, node->elements[i]); // Recounts it, if
+            hash_index_add(list, element);              // hashed
+            if (free_old != NULL) // If free_old is not NULL
+            {
+                free_old(node->elements[i]); // Cleans the replaced element
+            }
+            node->elements[i] = element;
+        }
+    }
+}
+
+void list_for_each(List list, void (*func)(void*, void*), void* ctx) // O(n)
+{
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            func(node->elements[i], ctx);
+        }
+    }
+}
+
+void* list_reduce(
+    List list,
+    void* init,
+    void* (*fold)(void*, void*, void*),
+    void* ctx
+) // O(n)
+{
+    void* accumulated = init;
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            accumulated = fold(accumulated, node->elements[i], ctx);
+        }
+    }
+    return accumulated;
+}
+
+bool list_any(List list, bool (*func)(void*)) // O(n)
+{
+    return list_find_if(list, func) != -1; // Stops at the first one
+}
+
+bool list_all(List list, bool (*func)(void*)) // O(n)
+{
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            if (!func(node->elements[i])) // Stops at the first one that fails
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+ListIndex list_find_if(List list, bool (*func)(void*)) // O(n)
+{
+    ListIndex position = 0; // Position of the node's first element
+    for (Node node = list->head; node != NULL; node = node->next)
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            if (func(node->elements[i])) // Stops at the first one that passes
+            {
+                return position + i;
+            }
+        }
+        position += node->count;
+    }
+    return -1;
+}
+
+List list_filter(List list, bool (*func)(void*)) // O(n)
+{
+    List newlist = list_create(); // Creates the list
+    Node node = list->head;       // Receives the head address
+    while (node != NULL)          // Traverses the entire list
+    {
+        for (int i = 0; i < node->count; i++)
+        {
+            if (func(node->elements[i])) // If the function returns true
+            {
+                list_insert_last(newlist, node->elements[i]); // Inserts it
+            }
+        }
+        node = node->next; // Moves to the next
+    }
+    return newlist;
+}
+
+ListIndex list_retain(
+    List list,
+    bool (*func)(void*),
+    void (*free_element)(void*)
+) // O(n)
+{
+    ListIndex removed = 0;    // Initializes removal counter
+    Node node = list->head;   // Receives the head address
+    Node previousNode = NULL; // Last node that kept elements
+    finger_forget(list, 0);   // Positions may move
+    while (node != NULL)      // Traverses the entire list
+    {
+        int kept = 0; // Elements kept in this node, compacted to the front
+        for (int i = 0; i < node->count; i++)
+        {
+            if (func(node->elements[i])) // If it passes, it stays
+            {
+                node->elements[kept++] = node->elements[i]; // Keeps it
+                continue;
+            }
+            hash_index_remove(list, node->elements[i]); // Before freeing
+            if (free_element != NULL) // If free_element is not NULL
+            {
+                free_element(node->elements[i]); // Cleans the element
+            }
+        }
+        removed += node->count - kept;
+        list->size -= node->count - kept; // Discounts the removed ones
+        node->count = kept;
+        Node nextNode = node->next; // Saves the next node
+        if (kept == 0)              // If nothing was kept, the node leaves
+        {
+            node_settle(list, previousNode, node);
+        }
+        else
+        {
+            previousNode = node; // previousNode becomes the current node
+        }
+        node = nextNode; // Node advances forward
+    }
+    return removed;
+}
+
+// Iterators
+
+void list_iterator_start(List list) // O(1)
+{
+    list->current = list->head; // Current receives the head address
+    list->current_offset = 0;   // Starting at its first element
+}
+
+bool list_iterator_has_next(List list) // O(1)
+{
+    return list->current !=
+           NULL; // If current is not NULL, there is a next element
+}
+
+void* list_iterator_get_next(List list) // O(1)
+{
+    void* element =
+        list->current->elements[list->current_offset++]; // Saves the element
+    if (list->current_offset == list->current->count) // If node is exhausted
+    {
+        list->current = list->current->next; // Moves to the next
+        list->current_offset = 0;
+    }
+    return element; // Returns the element
+}
+
+void list_iter_init(ListIter* iter, List list) // O(1)
+{
+    iter->list = list;
+    iter->node = list->head; // Starts at the head
+    iter->offset = 0;        // at its first element
+    iter->previous = NULL;   // Nothing before the head
+    iter->current = NULL;    // Nothing returned yet
+    iter->current_offset = 0;
+    iter->current_previous = NULL;
+    iter->backwards = false;
+}
+
+void list_iter_init_last(ListIter* iter, List list) // O(1)
+{
+    list_iter_init(iter, list);
+    iter->node = NULL;           // Starts past the tail
+    iter->previous = list->tail; // which comes right before it
+}
+
+bool list_iter_has_next(ListIter* iter) // O(1)
+{
+    return iter->node != NULL; // If node is not NULL, there is a next element
+}
+
+void* list_iter_next(ListIter* iter) // O(1)
+{
+    Node node = iter->node;
+    if (node == NULL) // At the end
+    {
+        return NULL;
+    }
+    iter->current_previous = iter->previous; // Remembers where it came from,
+    iter->current = node;                    // for list_iter_remove
+    iter->current_offset = iter->offset;
+    void* element = node->elements[iter->offset++];
+    if (iter->offset == node->count) // If node is exhausted
+    {
+        iter->previous = node;
+        iter->node = node->next; // Moves to the next
+        iter->offset = 0;
+    }
+    iter->backwards = false;
+    return element;
+}
+
+void* list_iter_peek(ListIter* iter) // O(1)
+{
+    Node node = iter->node;
+    return node != NULL ? node->elements[iter->offset] : NULL; // Stays there
+}
+
+bool list_iter_has_previous(ListIter* iter) // O(1)
+{
+    return iter->previous != NULL ||
+           (iter->node != NULL &&
+            iter->offset > 0); // If previous is not NULL, or the next element
+                               // is not the first of its node, there is one
+}
+
+static void iter_step_back(ListIter* iter) // O(1)
+{
+    Node node = iter->node;
+    if (node == NULL || iter->offset == 0) // The element before is the last
+    {                                      // one of the previous node
+        node = iter->previous;
+        iter->node = node;
+        iter->offset = node->count;
+        iter->previous = node->previous;
+    }
+    iter->offset--;
+}
+
+void* list_iter_previous(ListIter* iter) // O(1)
+{
+    if (!list_iter_has_previous(iter)) // At the beginning
+    {
+        return NULL;
+    }
+    iter_step_back(iter);                    // Moves back before it
+    iter->current_previous = iter->previous; // Remembers it, for
+    iter->current = iter->node;              // list_iter_remove
+    iter->current_offset = iter->offset;
+    iter->backwards = true;
+    Node node = iter->node;
+    return node->elements[iter->offset];
+}
+
+void* list_iter_remove(ListIter* iter) // O(1)
+{
+    Node node = iter->current;
+    if (node == NULL) // Nothing to remove
+    {
+        return NULL;
+    }
+    List list = iter->list;
+    void* element = node_remove_at(node, iter->current_offset);
+    if (iter->node == node &&
+        iter->offset > iter->current_offset) // The next element moved left
+    {                                        // with the others (going
+        iter->offset--;                      // backwards, it was removed)
+    }
+    if (node->count == 0) // The node leaves the list
+    {
+        if (iter->previous == node) // So the node before the next one is
+        {                           // the one before it
+            iter->previous = iter->current_previous;
+        }
+        if (iter->node == node) // Or, going backwards, the next one is the
+        {                       // first of the node after it
+            iter->node = node->next;
+            iter->offset = 0;
+        }
+        node_settle(list, iter->current_previous, node);
+    }
+    else if (iter->node == node &&
+             iter->offset == node->count) // Going backwards, the removed one
+    {                                     // was the last of its node
+        iter->previous = node;
+        iter->node = node->next;
+        iter->offset = 0;
+    }
+    iter->current = NULL; // Cannot be removed twice
+    list->size--;
+    hash_index_remove(list, element); // Uncounts it, if hashed
+    list->finger = NULL;              // Its position is unknown here
+    return element;
+}
+
+static void iter_insert_at(
+    ListIter* iter,
+    Node node,
+    int offset,
+    void* element
+) // O(1)
+{
+    List list = iter->list;
+    if (node->count == NODE_CAPACITY) // If full, the elements from offset on
+    {                                 // move to a new node, making room
+        Node half = node_create(list, node, node->next);
+        half->count = node->count - offset;
+        memcpy(
+            half->elements, &node->elements[offset], half->count * sizeof(void*)
+        );
+        node->count = offset;
+        node->next = half;
+        if (list->tail == node) // If the split node was the tail
+        {
+            list->tail = half; // The new node becomes the tail
+        }
+        if (iter->node == node && iter->offset >= offset) // If the next
+        {                                                 // element moved
+            iter->node = half;
+            iter->offset -= offset;
+            iter->previous = node;
+        }
+        else if (iter->previous == node && iter->node != node) // If the new
+        {                                                      // node went
+            iter->previous = half;                             // before it
+        }
+        if (iter->current == node && iter->current_offset >= offset)
+        {
+            iter->current = half;
+            iter->current_offset -= offset;
+            iter->current_previous = node;
+        }
+        else if (iter->current_previous == node && iter->current != node)
+        {
+            iter->current_previous = half;
+        }
+    }
+    else // The elements from offset on shift right
+    {
+        if (iter->node == node && iter->offset >= offset)
+        {
+            iter->offset++;
+        }
+        if (iter->current == node && iter->current_offset >= offset)
+        {
+            iter->current_offset++;
+        }
+    }
+    node_insert_at(node, offset, element); // There is room now
+    list->size++;
+    hash_index_add(list, element); // Counts it, if hashed
+    list->finger = NULL;           // Its position is unknown here
+}
+
+void list_iter_insert_before(ListIter* iter, void* element) // O(1)
+{
+    if (iter->current == NULL || iter->backwards) // No element to go before,
+    {                                             // or it is right after the
+        list_iter_insert_after(iter, element);    // iterator anyway
+        return;
+    }
+    iter_insert_at(iter, iter->current, iter->current_offset, element);
+}
+
+static void iter_insert_here(ListIter* iter, void* element) // O(1)
+{
+    List list = iter->list;
+    Node previousNode = iter->previous;
+    if (iter->node != NULL &&
+        (iter->offset > 0 || previousNode == NULL ||
+         previousNode->count == NODE_CAPACITY)) // Goes right before the next
+    {                                           // element, in its node
+        iter_insert_at(iter, iter->node, iter->offset, element);
+        return;
+    }
+    if (previousNode == NULL || previousNode->count == NODE_CAPACITY)
+    {                                      // If there is no room at the end
+        Node node = node_create(           // of the previous node, a new
+            list,                          // node goes after it
+            previousNode,
+            previousNode == NULL ? list->head : previousNode->next
+        );
+        if (previousNode == NULL)
+        {
+            list->head = node;
+        }
+        else
+        {
+            previousNode->next = node;
+        }
+        if (node->next == NULL) // If it went after the tail
+        {
+            list->tail = node;
+        }
+        iter->previous = node;
+        previousNode = node;
+    }
+    previousNode->elements[previousNode->count++] = element; // Appends it
+    list->size++;
+    hash_index_add(list, element); // Counts it, if hashed
+    list->finger = NULL;           // Its position is unknown here
+}
+
+void list_iter_insert_after(ListIter* iter, void* element) // O(1)
+{
+    iter_insert_here(iter, element); // Goes right before the next one, and is
+    if (iter->backwards)             // skipped, moving forward, or the
+    {                                // iterator goes back before it, moving
+        iter_step_back(iter);        // backwards
+    }
+}
@@ -0,0 +1,187 @@
+#include "unity/unity.h"
+
+#include "../src/compact_list.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+CompactList list;
+
+int numbers[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+void setUp(void) { list = compact_list_create(); }
+
+void tearDown(void) { compact_list_destroy(list, NULL); }
+
+/*******************************************************************************
+ Helper functions.
+ ******************************************************************************/
+
+bool is_equal(void* a, void* b) { return a == b; }
+
+void add_number(void* number, void* sum) { *(int*)sum += *(int*)number; }
+
+int* number_address_of(int number) { return &(numbers[number - 1]); }
+
+void insert_numbers(int start, int end)
+{
+    for (int i = start; i <= end; i++)
+    {
+        compact_list_insert_last(list, number_address_of(i));
+    }
+}
+
+void assert_numbers(int expected[], int count)
+{
+    TEST_ASSERT_EQUAL(count, compact_list_size(list));
+    void* array[10];
+    compact_list_to_array(list, array);
+    for (int i = 0; i < count; i++)
+    {
+        TEST_ASSERT_EQUAL(number_address_of(expected[i]), array[i]);
+        TEST_ASSERT_EQUAL(
+            number_address_of(expected[i]), compact_list_get(list, i)
+        );
+    }
+    TEST_ASSERT_EQUAL(
+        count > 0 ? number_address_of(expected[count - 1]) : NULL,
+        compact_list_get_last(list)
+    );
+}
+
+/*******************************************************************************
+ Tests.
+ ******************************************************************************/
+
+void test_compact_list_empty()
+{
+    TEST_ASSERT_TRUE(compact_list_is_empty(list));
+    TEST_ASSERT_EQUAL(0, compact_list_size(list));
+    TEST_ASSERT_NULL(compact_list_get_first(list));
+    TEST_ASSERT_NULL(compact_list_get_last(list));
+    TEST_ASSERT_NULL(compact_list_get(list, 0));
+    TEST_ASSERT_NULL(compact_list_remove_first(list));
+    TEST_ASSERT_NULL(compact_list_remove_last(list));
+    TEST_ASSERT_NULL(compact_list_remove(list, 0));
+    TEST_ASSERT_EQUAL(-1, compact_list_find(list, is_equal, &numbers[0]));
+}
+
+void test_compact_list_insert()
+{
+    TEST_ASSERT_TRUE(compact_list_insert_last(list, number_address_of(3)));
+    TEST_ASSERT_TRUE(compact_list_insert_first(list, number_address_of(1)));
+    TEST_ASSERT_TRUE(compact_list_insert(list, number_address_of(2), 1));
+    TEST_ASSERT_TRUE(
+        compact_list_insert(list, number_address_of(4), 3) // At the end
+    );
+    TEST_ASSERT_FALSE(
+        compact_list_insert(list, number_address_of(5), 5) // Does not exist
+    );
+    TEST_ASSERT_FALSE(compact_list_insert(list, number_address_of(5), -1));
+    assert_numbers((int[]){1, 2, 3, 4}, 4);
+    TEST_ASSERT_EQUAL(number_address_of(1), compact_list_get_first(list));
+    TEST_ASSERT_NULL(compact_list_get(list, 4));
+    TEST_ASSERT_EQUAL(2, compact_list_find(list, is_equal, &numbers[2]));
+    TEST_ASSERT_EQUAL(-1, compact_list_find(list, is_equal, &numbers[4]));
+}
+
+void test_compact_list_remove()
+{
+    insert_numbers(1, 6);
+    TEST_ASSERT_EQUAL(number_address_of(1), compact_list_remove_first(list));
+    TEST_ASSERT_EQUAL(number_address_of(6), compact_list_remove_last(list));
+    TEST_ASSERT_EQUAL(number_address_of(3), compact_list_remove(list, 1));
+    TEST_ASSERT_NULL(compact_list_remove(list, 3));
+    assert_numbers((int[]){2, 4, 5}, 3);
+    TEST_ASSERT_EQUAL(number_address_of(5), compact_list_remove(list, 2));
+    compact_list_insert_last(list, number_address_of(7)); // Tail moved back
+    assert_numbers((int[]){2, 4, 7}, 3);
+    while (!compact_list_is_empty(list))
+    {
+        compact_list_remove_last(list);
+    }
+    assert_numbers(NULL, 0);
+    TEST_ASSERT_NULL(compact_list_get_first(list));
+    insert_numbers(8, 9); // Usable again after being emptied
+    assert_numbers((int[]){8, 9}, 2);
+}
+
+void test_compact_list_many_elements()
+{
+    compact_list_reserve(list, 100);
+    for (int i = 0; i < 10000; i++) // Grows the arena many times
+    {
+        compact_list_insert_last(list, &numbers[i % 10]);
+    }
+    for (int i = 0; i < 5000; i++) // Frees every other node
+    {
+        compact_list_remove(list, i);
+    }
+    for (int i = 0; i < 5000; i++) // Reuses them
+    {
+        compact_list_insert_first(list, &numbers[0]);
+    }
+    TEST_ASSERT_EQUAL(10000, compact_list_size(list));
+    for (int i = 0; i < 5000; i++)
+    {
+        TEST_ASSERT_EQUAL(&numbers[0], compact_list_remove_first(list));
+    }
+    for (int i = 0; i < 5000; i++) // Odd positions of the original order
+    {
+        TEST_ASSERT_EQUAL(
+            &numbers[(2 * i + 1) % 10], compact_list_get(list, i)
+        );
+    }
+    compact_list_make_empty(list, NULL);
+    TEST_ASSERT_TRUE(compact_list_is_empty(list));
+    insert_numbers(1, 2);
+    assert_numbers((int[]){1, 2}, 2);
+}
+
+void test_compact_list_offsets()
+{
+    compact_list_destroy(list, NULL);
+    list = compact_list_create_offsets(numbers); // Elements are in numbers
+    insert_numbers(1, 10);
+    compact_list_remove(list, 4);
+    compact_list_insert(list, number_address_of(10), 0);
+    assert_numbers((int[]){10, 1, 2, 3, 4, 6, 7, 8, 9, 10}, 10);
+    TEST_ASSERT_EQUAL(0, compact_list_find(list, is_equal, &numbers[9]));
+    TEST_ASSERT_EQUAL(4, *(int*)compact_list_get(list, 4)); // Same address
+}
+
+void test_compact_list_for_each()
+{
+    int sum = 0;
+    compact_list_for_each(list, add_number, &sum);
+    TEST_ASSERT_EQUAL(0, sum);
+    insert_numbers(1, 4);
+    compact_list_for_each(list, add_number, &sum);
+    TEST_ASSERT_EQUAL(10, sum);
+}
+
+void test_compact_list_free_elements()
+{
+    for (int i = 0; i < 100; i++) // Freed by make_empty and destroy, so
+    {                             // leaks show up under a leak checker
+        compact_list_insert_last(list, malloc(sizeof(int)));
+    }
+    compact_list_make_empty(list, free);
+    TEST_ASSERT_TRUE(compact_list_is_empty(list));
+    compact_list_insert_last(list, malloc(sizeof(int)));
+    compact_list_destroy(list, free);
+    list = compact_list_create();
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_compact_list_empty);
+    RUN_TEST(test_compact_list_insert);
+    RUN_TEST(test_compact_list_remove);
+    RUN_TEST(test_compact_list_many_elements);
+    RUN_TEST(test_compact_list_offsets);
+    RUN_TEST(test_compact_list_for_each);
+    RUN_TEST(test_compact_list_free_elements);
+    return UNITY_END();
+}
@@ -2,6 +2,8 @@
 
 #include "../src/list.h"
 
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 // #include <mcheck.h>
@@ -33,6 +35,8 @@ void tearDown(void) { list_destroy(list, NULL); }
 
 bool is_equal(void* a, void* b) { return a == b; }
 
+size_t hash_address(void* a) { return (size_t)a; }
+
 void insert_numbers(int start, int end)
 {
     for (int i = start - 1; i < end; i++)
@@ -104,6 +108,29 @@ void test_list_get()
     TEST_ASSERT_EQUAL(number_address_of(2), list_get(list, 1));
 }
 
+void test_list_get_sequential()
+{
+    insert_numbers(1, 10);
+    for (int i = 0; i < list_size(list); i++) // Resumes from the last get
+    {
+        TEST_ASSERT_EQUAL(number_address_of(i + 1), list_get(list, i));
+    }
+    TEST_ASSERT_EQUAL(number_address_of(3), list_get(list, 2)); // Backwards
+    list_insert_first(list, &strings[0]);
+    TEST_ASSERT_EQUAL(number_address_of(3), list_get(list, 3));
+    list_insert(list, &strings[1], 2);
+    TEST_ASSERT_EQUAL(number_address_of(2), list_get(list, 3));
+    TEST_ASSERT_EQUAL(number_address_of(6), list_get(list, 7));
+    TEST_ASSERT_EQUAL(number_address_of(6), list_remove(list, 7));
+    TEST_ASSERT_EQUAL(number_address_of(7), list_get(list, 7));
+    list_remove_all(list, is_equal, NULL, number_address_of(7));
+    TEST_ASSERT_EQUAL(number_address_of(8), list_get(list, 7));
+    TEST_ASSERT_EQUAL(number_address_of(10), list_remove_last(list));
+    TEST_ASSERT_EQUAL(number_address_of(9), list_get(list, 8));
+    TEST_ASSERT_EQUAL(string_address_of(1), list_remove_first(list));
+    TEST_ASSERT_EQUAL(number_address_of(9), list_get(list, 7));
+}
+
 void test_list_find()
 {
     TEST_ASSERT_EQUAL(-1, list_find(list, is_equal, number_address_of(1)));
@@ -222,6 +249,63 @@ void test_list_to_array()
     TEST_ASSERT_EQUAL(string_address_of(3), array[2]);
 }
 
+void test_list_from_array()
+{
+    void* array[] = {&strings[0], &strings[1], &strings[2]};
+    List l = list_from_array(array, 3);
+    TEST_ASSERT_EQUAL(3, list_size(l));
+    TEST_ASSERT_EQUAL(string_address_of(1), list_get_first(l));
+    TEST_ASSERT_EQUAL(string_address_of(2), list_get(l, 1));
+    TEST_ASSERT_EQUAL(string_address_of(3), list_get_last(l));
+    TEST_ASSERT_EQUAL(string_address_of(2), list_remove(l, 1));
+    list_insert_last(l, &strings[3]); // Reuses the released node
+    list_insert_last(l, &strings[4]); // Allocated on its own, as the list is
+    TEST_ASSERT_EQUAL(string_address_of(5), list_get(l, 3)); // not pooled
+    TEST_ASSERT_EQUAL(string_address_of(3), list_remove(l, 1));
+    list_destroy(l, NULL);
+}
+
+void test_list_insert_last_bulk()
+{
+    void* array[] = {&numbers[0], &numbers[1], &numbers[2], &numbers[3]};
+    list_insert_last_bulk(list, array, 0);
+    TEST_ASSERT_TRUE(list_is_empty(list));
+    list_insert_last_bulk(list, array, 2);
+    list_insert_last(list, &strings[0]);
+    list_insert_last_bulk(list, array, 4);
+    TEST_ASSERT_EQUAL(7, list_size(list));
+    TEST_ASSERT_EQUAL(number_address_of(2), list_get(list, 1));
+    TEST_ASSERT_EQUAL(string_address_of(1), list_get(list, 2));
+    TEST_ASSERT_EQUAL(number_address_of(4), list_get_last(list));
+    List l = list_create_pooled(5);
+    list_insert_last(l, &strings[0]);
+    list_insert_last_bulk(l, array, 3); // Fits in the current chunk
+    list_insert_last_bulk(l, array, 4); // Gets a chunk of its own
+    list_insert_last(l, &strings[1]);
+    TEST_ASSERT_EQUAL(9, list_size(l));
+    TEST_ASSERT_EQUAL(number_address_of(3), list_get(l, 3));
+    TEST_ASSERT_EQUAL(number_address_of(1), list_get(l, 4));
+    TEST_ASSERT_EQUAL(string_address_of(2), list_get_last(l));
+    list_destroy(l, NULL);
+    l = list_create_doubly();
+    list_insert_last(l, &strings[0]); // Stay where they are, before the
+    list_insert_last(l, &strings[1]); // chunk of the bulk insert
+    ListIter iter;
+    list_iter_init(&iter, l);
+    TEST_ASSERT_EQUAL(string_address_of(1), list_iter_next(&iter));
+    list_insert_last_bulk(l, array, 4);
+    TEST_ASSERT_EQUAL(string_address_of(2), list_iter_next(&iter)); // Valid
+    TEST_ASSERT_EQUAL(number_address_of(1), list_iter_next(&iter));
+    TEST_ASSERT_EQUAL(string_address_of(2), list_remove(l, 1));
+    TEST_ASSERT_EQUAL(number_address_of(4), list_remove_last(l));
+    list_insert_last(l, &strings[2]); // Reuses a released node
+    TEST_ASSERT_EQUAL(5, list_size(l));
+    TEST_ASSERT_EQUAL(string_address_of(1), list_get_first(l));
+    TEST_ASSERT_EQUAL(number_address_of(3), list_get(l, 3));
+    TEST_ASSERT_EQUAL(string_address_of(3), list_get_last(l));
+    list_destroy(l, NULL);
+}
+
 void test_list_count_all()
 {
     TEST_ASSERT_EQUAL(
@@ -297,6 +381,32 @@ void test_list_remove_duplicates()
         list, (bool (*)(void*, void*))equal_to_string, NULL, &strings[1]
     );
     TEST_ASSERT_EQUAL(2, count);
+    TEST_ASSERT_EQUAL(4, list_size(list));
+    TEST_ASSERT_EQUAL(string_address_of(2), list_get(list, 1));
+    TEST_ASSERT_EQUAL(string_address_of(3), list_get_last(list));
+}
+
+void test_list_unique()
+{
+    insert_numbers(1, 3);
+    insert_numbers(2, 5);
+    insert_numbers(1, 5);
+    TEST_ASSERT_EQUAL(7, list_unique(list, hash_address, is_equal, NULL));
+    TEST_ASSERT_EQUAL(5, list_size(list));
+    for (int i = 0; i < 5; i++) // First occurrences, in order
+    {
+        TEST_ASSERT_EQUAL(number_address_of(i + 1), list_get(list, i));
+    }
+    TEST_ASSERT_EQUAL(number_address_of(5), list_get_last(list));
+    TEST_ASSERT_EQUAL(0, list_unique(list, hash_address, is_equal, NULL));
+    for (int i = 0; i < 40; i++) // Duplicates spread over many nodes
+    {
+        insert_numbers(1, 10);
+    }
+    TEST_ASSERT_EQUAL(395, list_unique(list, hash_address, is_equal, NULL));
+    TEST_ASSERT_EQUAL(10, list_size(list));
+    TEST_ASSERT_EQUAL(number_address_of(10), list_get_last(list));
+    TEST_ASSERT_EQUAL(9, list_find(list, is_equal, number_address_of(10)));
 }
 
 void test_list_join()
@@ -311,6 +421,109 @@ void test_list_join()
     list_destroy(l, NULL);
 }
 
+void test_list_splice()
+{
+    insert_strings(1, 3);
+    List l2 = list_create();
+    list_splice(list, l2); // Empty list2
+    TEST_ASSERT_EQUAL(3, list_size(list));
+    list_insert_last(l2, &strings[3]);
+    list_insert_last(l2, &strings[4]);
+    list_splice(list, l2);
+    TEST_ASSERT_EQUAL(5, list_size(list));
+    TEST_ASSERT_TRUE(list_is_empty(l2));
+    TEST_ASSERT_NULL(list_get_first(l2));
+    TEST_ASSERT_EQUAL(string_address_of(5), list_get_last(list));
+    TEST_ASSERT_EQUAL(string_address_of(4), list_get(list, 3));
+    list_insert_last(list, &strings[5]); // Tail was fixed up
+    TEST_ASSERT_EQUAL(string_address_of(6), list_get(list, 5));
+    list_insert_last(l2, &strings[6]); // list2 can be reused
+    list_splice(l2, list);             // Into an empty list
+    TEST_ASSERT_EQUAL(7, list_size(l2));
+    TEST_ASSERT_EQUAL(string_address_of(1), list_get(l2, 1));
+    TEST_ASSERT_EQUAL(string_address_of(6), list_get_last(l2));
+    list_destroy(l2, NULL);
+}
+
+void test_list_splice_pooled()
+{
+    List l1 = list_create_pooled(2);
+    List l2 = list_create_pooled(3);
+    for (int i = 0; i < 5; i++)
+    {
+        list_insert_last(l1, &numbers[i]);
+        list_insert_last(l2, &numbers[i + 5]);
+    }
+    list_remove_first(l2); // Leaves a released node in list2's chunks
+    list_splice(l1, l2);   // Chunks move along with the nodes
+    TEST_ASSERT_EQUAL(9, list_size(l1));
+    list_insert_last(l2, &strings[0]);
+    list_splice(list, l2); // Only one pooled, but the chunk moves all the same
+    TEST_ASSERT_EQUAL(1, list_size(list));
+    TEST_ASSERT_TRUE(list_is_empty(l2));
+    list_destroy(l2, NULL);
+    void* array[] = {&numbers[0], &numbers[1], &numbers[2]};
+    l2 = list_from_array(array, 3);
+    list_remove(l2, 1); // Released nodes move too
+    List l3 = list_create_doubly();
+    list_insert_last(l3, &numbers[3]);
+    list_splice(l2, l3); // Doubly nodes fit where singly ones are expected
+    list_splice(list, l2);
+    TEST_ASSERT_EQUAL(4, list_size(list));
+    TEST_ASSERT_EQUAL(number_address_of(3), list_get(list, 2));
+    TEST_ASSERT_EQUAL(number_address_of(4), list_get_last(list));
+    list_destroy(l3, NULL);
+    list_destroy(l2, NULL);
+    for (int i = 0; i < 5; i++) // list1 first reuses list2's released node,
+    {                           // then carves from its own chunk
+        list_insert_last(l1, &strings[i]);
+    }
+    TEST_ASSERT_EQUAL(number_address_of(7), list_get(l1, 5));
+    TEST_ASSERT_EQUAL(string_address_of(5), list_get_last(l1));
+    list_destroy(l1, NULL);
+}
+
+int compare_numbers(void* a, void* b) { return *(int*)a - *(int*)b; }
+
+int compare_tens(void* a, void* b) { return *(int*)a / 10 - *(int*)b / 10; }
+
+void test_list_sort()
+{
+    list_sort(list, compare_numbers);
+    TEST_ASSERT_EQUAL(0, list_size(list));
+    int order[] = {7, 3, 10, 1, 5, 9, 2, 8, 4, 6};
+    for (int i = 0; i < 10; i++)
+    {
+        insert_number(order[i]);
+    }
+    list_sort(list, compare_numbers);
+    for (int i = 0; i < 10; i++)
+    {
+        TEST_ASSERT_EQUAL(number_address_of(i + 1), list_get(list, i));
+    }
+    TEST_ASSERT_EQUAL(number_address_of(10), list_get_last(list));
+    insert_number(1); // The tail must be right after sorting
+    TEST_ASSERT_EQUAL(number_address_of(1), list_get(list, 10));
+}
+
+void test_list_sort_stable()
+{
+    int values[100];
+    for (int i = 0; i < 100; i++) // Tens descending, units ascending
+    {
+        values[i] = (9 - i / 10) * 10 + i % 10;
+        list_insert_last(list, &values[i]);
+    }
+    list_set_indexed(list, true);
+    list_sort(list, compare_tens); // Only the tens are compared
+    for (int i = 0; i < 100; i++) // Equal tens keep their order
+    {
+        TEST_ASSERT_EQUAL_INT(i, *(int*)list_get(list, i));
+    }
+    TEST_ASSERT_EQUAL(&values[9], list_get_last(list));
+    TEST_ASSERT_EQUAL(&values[50], list_remove(list, 40));
+}
+
 void test_list_get_sublist_between()
 {
     insert_strings(1, 5);
@@ -324,7 +537,7 @@ void test_list_get_sublist_between()
 void test_list_get_sublist()
 {
     insert_strings(1, 5);
-    int indexes[] = {0, 2, 4};
+    ListIndex indexes[] = {0, 2, 4};
     List l = list_get_sublist(list, indexes, 3);
     TEST_ASSERT_EQUAL(string_address_of(1), list_get(l, 0));
     TEST_ASSERT_EQUAL(string_address_of(3), list_get(l, 1));
@@ -353,6 +566,51 @@ void test_list_map()
 
 bool is_even(int* i) { return *i % 2 == 0; }
 
+void* next_number(void* number)
+{
+    return *(int*)number < 10 ? number_address_of(*(int*)number + 1) : number;
+}
+
+int freed;
+
+void count_freed(void* element)
+{
+    (void)element;
+    freed++;
+}
+
+void test_list_map_inplace()
+{
+    insert_numbers(1, 10);
+    insert_numbers(1, 10);
+    list_set_hash_index(list, hash_address, is_equal);
+    freed = 0;
+    list_map_inplace(list, next_number, count_freed);
+    TEST_ASSERT_EQUAL(18, freed); // 10 stays itself
+    TEST_ASSERT_EQUAL(20, list_size(list));
+    for (int i = 0; i < 20; i++)
+    {
+        TEST_ASSERT_EQUAL(
+            number_address_of(i % 10 < 9 ? i % 10 + 2 : 10), list_get(list, i)
+        );
+    }
+    TEST_ASSERT_EQUAL(0, list_count_all(list, is_equal, number_address_of(1)));
+    TEST_ASSERT_EQUAL(4, list_count_all(list, is_equal, number_address_of(10)));
+}
+
+void add_to(void* number, void* sum) { *(int*)sum += *(int*)number; }
+
+void test_list_for_each()
+{
+    int sum = 0;
+    list_for_each(list, add_to, &sum);
+    TEST_ASSERT_EQUAL(0, sum);
+    insert_numbers(1, 10);
+    insert_numbers(1, 10);
+    list_for_each(list, add_to, &sum);
+    TEST_ASSERT_EQUAL(110, sum);
+}
+
 void test_list_filter()
 {
     insert_numbers(1, 5);
@@ -363,6 +621,512 @@ void test_list_filter()
     list_destroy(l, NULL);
 }
 
+bool is_above_three(void* number) { return *(int*)number > 3; }
+
+void test_list_retain()
+{
+    TEST_ASSERT_EQUAL(0, list_retain(list, is_above_three, NULL));
+    insert_numbers(1, 10);
+    insert_numbers(1, 10);
+    TEST_ASSERT_EQUAL(6, list_retain(list, is_above_three, NULL));
+    TEST_ASSERT_EQUAL(14, list_size(list));
+    for (int i = 0; i < 14; i++)
+    {
+        TEST_ASSERT_EQUAL(number_address_of(i % 7 + 4), list_get(list, i));
+    }
+    TEST_ASSERT_EQUAL(0, list_retain(list, is_above_three, NULL));
+    TEST_ASSERT_EQUAL(number_address_of(10), list_get_last(list));
+    list_make_empty(list, NULL);
+    insert_numbers(4, 6);
+    insert_numbers(1, 3);
+    TEST_ASSERT_EQUAL(3, list_retain(list, is_above_three, NULL));
+    TEST_ASSERT_EQUAL(number_address_of(6), list_get_last(list));
+    insert_number(1); // The tail must be right
+    TEST_ASSERT_EQUAL(number_address_of(1), list_get(list, 3));
+}
+
+void* sum_into(void* sum, void* number, void* ctx)
+{
+    (*(int*)ctx)++; // Counts the calls
+    *(int*)sum += *(int*)number;
+    return sum;
+}
+
+void test_list_reduce()
+{
+    int sum = 0;
+    int calls = 0;
+    TEST_ASSERT_EQUAL(&sum, list_reduce(list, &sum, sum_into, &calls));
+    TEST_ASSERT_EQUAL(0, calls);
+    insert_numbers(1, 10);
+    insert_numbers(1, 10);
+    TEST_ASSERT_EQUAL(&sum, list_reduce(list, &sum, sum_into, &calls));
+    TEST_ASSERT_EQUAL(110, sum);
+    TEST_ASSERT_EQUAL(20, calls);
+}
+
+int predicate_calls;
+
+bool is_above_eight(void* number)
+{
+    predicate_calls++;
+    return *(int*)number > 8;
+}
+
+void test_list_any_all_find_if()
+{
+    TEST_ASSERT_FALSE(list_any(list, is_above_eight));
+    TEST_ASSERT_TRUE(list_all(list, is_above_eight));
+    TEST_ASSERT_EQUAL(-1, list_find_if(list, is_above_eight));
+    for (int i = 0; i < 3; i++)
+    {
+        insert_numbers(1, 10);
+    }
+    predicate_calls = 0;
+    TEST_ASSERT_TRUE(list_any(list, is_above_eight));
+    TEST_ASSERT_EQUAL(9, predicate_calls); // Stops at the first one
+    TEST_ASSERT_FALSE(list_all(list, is_above_eight));
+    TEST_ASSERT_EQUAL(10, predicate_calls); // Stops at the first one
+    TEST_ASSERT_EQUAL(8, list_find_if(list, is_above_eight));
+    TEST_ASSERT_EQUAL(3, list_find_if(list, is_above_three));
+    list_retain(list, is_above_eight, NULL);
+    TEST_ASSERT_TRUE(list_all(list, is_above_eight));
+    TEST_ASSERT_EQUAL(0, list_find_if(list, is_above_eight));
+}
+
+void test_list_create_pooled()
+{
+    List l = list_create_pooled(4);
+    for (int i = 0; i < 10; i++) // Spans three chunks
+    {
+        list_insert_last(l, &numbers[i]);
+    }
+    TEST_ASSERT_EQUAL(10, list_size(l));
+    TEST_ASSERT_EQUAL(number_address_of(1), list_remove_first(l));
+    TEST_ASSERT_EQUAL(number_address_of(10), list_remove_last(l));
+    TEST_ASSERT_EQUAL(number_address_of(5), list_remove(l, 3));
+    list_insert_first(l, &strings[0]); // Reuses released nodes
+    list_insert(l, &strings[1], 4);
+    list_insert_last(l, &strings[2]);
+    TEST_ASSERT_EQUAL(10, list_size(l));
+    TEST_ASSERT_EQUAL(string_address_of(1), list_get(l, 0));
+    TEST_ASSERT_EQUAL(number_address_of(4), list_get(l, 3));
+    TEST_ASSERT_EQUAL(string_address_of(2), list_get(l, 4));
+    TEST_ASSERT_EQUAL(number_address_of(6), list_get(l, 5));
+    TEST_ASSERT_EQUAL(string_address_of(3), list_get_last(l));
+    list_make_empty(l, NULL);
+    TEST_ASSERT_TRUE(list_is_empty(l));
+    int* n = malloc(sizeof(int));
+    list_insert_last(l, n);
+    TEST_ASSERT_EQUAL(n, list_get_first(l));
+    list_destroy(l, (void (*)(void*))free_int);
+}
+
+void check_many_elements()
+{
+    static int values[100];
+    int* expected[100]; // Mirrors the list in an array
+    int size = 0;
+    for (int i = 0; i < 100; i++) // Inserts at the front, middle and back
+    {
+        values[i] = i;
+        int position = i % 3 == 0 ? 0 : i % 3 == 1 ? size / 2 : size;
+        list_insert(list, &values[i], position);
+        memmove(
+            &expected[position + 1],
+            &expected[position],
+            (size - position) * sizeof(int*)
+        );
+        expected[position] = &values[i];
+        size++;
+    }
+    for (int i = 0; i < 40; i++) // Removes from the middle and the back
+    {
+        int position = i % 2 == 0 ? (size * 2) / 3 : size - 1;
+        TEST_ASSERT_EQUAL(expected[position], list_remove(list, position));
+        memmove(
+            &expected[position],
+            &expected[position + 1],
+            (size - position - 1) * sizeof(int*)
+        );
+        size--;
+    }
+    TEST_ASSERT_EQUAL(size, list_size(list));
+    TEST_ASSERT_EQUAL(expected[0], list_get_first(list));
+    TEST_ASSERT_EQUAL(expected[size - 1], list_get_last(list));
+    int* array[100];
+    list_to_array(list, (void**)array);
+    list_iterator_start(list);
+    for (int i = 0; i < size; i++)
+    {
+        TEST_ASSERT_EQUAL(expected[i], list_get(list, i));
+        TEST_ASSERT_EQUAL(expected[i], array[i]);
+        TEST_ASSERT_EQUAL(expected[i], list_iterator_get_next(list));
+    }
+    TEST_ASSERT_FALSE(list_iterator_has_next(list));
+    TEST_ASSERT_EQUAL(1, list_remove_all(list, is_equal, NULL, expected[5]));
+    TEST_ASSERT_EQUAL(size - 1, list_size(list));
+    TEST_ASSERT_EQUAL(-1, list_find(list, is_equal, expected[5]));
+    TEST_ASSERT_EQUAL(10, list_find(list, is_equal, expected[11]));
+}
+
+void test_list_many_elements() { check_many_elements(); }
+
+void test_list_create_doubly()
+{
+    List singly = list;
+    list = list_create_doubly();
+    check_many_elements(); // Same behavior as any other list
+    list_make_empty(list, NULL);
+    for (int i = 0; i < 1000; i++) // Used as a stack, from the back
+    {
+        list_insert_last(list, &numbers[i % 10]);
+        if (i % 3 == 2)
+        {
+            TEST_ASSERT_EQUAL(&numbers[i % 10], list_remove_last(list));
+        }
+    }
+    TEST_ASSERT_EQUAL(667, list_size(list));
+    list_insert_first(list, number_address_of(10)); // Every way of linking
+    list_insert(list, number_address_of(9), 300);   // nodes must keep them
+    list_remove(list, 100);                         // pointing back
+    list_remove_first(list);
+    list_remove_all(list, is_equal, NULL, number_address_of(1));
+    list_sort(list, compare_numbers);
+    insert_numbers(1, 3); // Spliced from a singly list, so copied
+    list_splice(list, singly);
+    TEST_ASSERT_TRUE(list_is_empty(singly));
+    int size = list_size(list);
+    int* array[700];
+    list_to_array(list, (void**)array);
+    for (int i = size - 1; i >= 0; i--) // Pops everything in reverse order
+    {
+        TEST_ASSERT_EQUAL(array[i], list_get_last(list));
+        TEST_ASSERT_EQUAL(array[i], list_remove_last(list));
+    }
+    TEST_ASSERT_TRUE(list_is_empty(list));
+    TEST_ASSERT_NULL(list_remove_last(list));
+    list_destroy(list, NULL);
+    list = singly;
+}
+
+void test_list_set_indexed()
+{
+    list_set_indexed(list, true);
+    check_many_elements();
+    insert_numbers(1, 10);
+    insert_numbers(1, 10);
+    TEST_ASSERT_EQUAL(2, list_remove_all(list, is_equal, NULL, &numbers[4]));
+    TEST_ASSERT_EQUAL(
+        number_address_of(7), list_get(list, list_size(list) - 4)
+    );
+    TEST_ASSERT_EQUAL(number_address_of(10), list_remove_last(list));
+    list_set_indexed(list, false);
+    TEST_ASSERT_EQUAL(number_address_of(9), list_remove_last(list));
+    list_set_indexed(list, true);
+    list_make_empty(list, NULL);
+    insert_numbers(1, 3);
+    TEST_ASSERT_EQUAL(number_address_of(2), list_remove(list, 1));
+    TEST_ASSERT_EQUAL(number_address_of(3), list_get(list, 1));
+}
+
+void test_list_set_hash_index()
+{
+    insert_numbers(1, 5);
+    insert_numbers(1, 5);
+    list_set_hash_index(list, hash_address, is_equal);
+    TEST_ASSERT_EQUAL(2, list_count_all(list, is_equal, &numbers[2]));
+    TEST_ASSERT_EQUAL(-1, list_find(list, is_equal, &numbers[7]));
+    TEST_ASSERT_EQUAL(3, list_find(list, is_equal, &numbers[3]));
+    TEST_ASSERT_EQUAL(
+        2, list_remove_duplicates(list, is_equal, NULL, &numbers[0])
+    );
+    TEST_ASSERT_EQUAL(
+        1, list_remove_duplicates(list, is_equal, NULL, &numbers[0])
+    );
+    TEST_ASSERT_EQUAL(2, list_remove_all(list, is_equal, NULL, &numbers[1]));
+    TEST_ASSERT_EQUAL(0, list_remove_all(list, is_equal, NULL, &numbers[1]));
+    TEST_ASSERT_EQUAL(7, list_size(list));
+    list_remove_first(list);
+    list_remove_last(list);
+    list_remove(list, 1);
+    insert_number(9);
+    TEST_ASSERT_EQUAL(0, list_count_all(list, is_equal, &numbers[0]));
+    TEST_ASSERT_EQUAL(1, list_count_all(list, is_equal, &numbers[8]));
+    TEST_ASSERT_EQUAL(3, list_find(list, is_equal, &numbers[3])); // Rebuilt
+    TEST_ASSERT_EQUAL(4, list_find(list, is_equal, &numbers[8]));
+    List other = list_create();
+    list_insert_last(other, &numbers[8]);
+    list_set_hash_index(other, hash_address, is_equal);
+    list_splice(list, other);
+    TEST_ASSERT_EQUAL(2, list_count_all(list, is_equal, &numbers[8]));
+    TEST_ASSERT_EQUAL(0, list_count_all(other, is_equal, &numbers[8]));
+    TEST_ASSERT_EQUAL(4, list_find(list, is_equal, &numbers[8]));
+    insert_number(7); // Appended, so the positions are kept
+    TEST_ASSERT_EQUAL(6, list_find(list, is_equal, &numbers[6]));
+    list_insert_first(list, &numbers[6]);
+    TEST_ASSERT_EQUAL(0, list_find(list, is_equal, &numbers[6]));
+    TEST_ASSERT_EQUAL(5, list_find(list, is_equal, &numbers[8]));
+    list_remove_first(list); // Its later occurrence becomes the first
+    TEST_ASSERT_EQUAL(6, list_find(list, is_equal, &numbers[6]));
+    TEST_ASSERT_EQUAL(4, list_find(list, is_equal, &numbers[8]));
+    list_remove_last(list);
+    TEST_ASSERT_EQUAL(-1, list_find(list, is_equal, &numbers[6]));
+    list_destroy(other, NULL);
+    list_make_empty(list, NULL);
+    TEST_ASSERT_EQUAL(0, list_count_all(list, is_equal, &numbers[8]));
+    check_many_elements();
+    list_set_hash_index(list, NULL, NULL);
+    TEST_ASSERT_EQUAL(10, list_find(list, is_equal, list_get(list, 10)));
+}
+
+void test_list_iter()
+{
+    ListIter outer;
+    list_iter_init(&outer, list);
+    TEST_ASSERT_FALSE(list_iter_has_next(&outer));
+    TEST_ASSERT_NULL(list_iter_next(&outer));
+    TEST_ASSERT_NULL(list_iter_peek(&outer));
+    insert_numbers(1, 10);
+    insert_numbers(1, 10);
+    list_iter_init(&outer, list);
+    for (int i = 0; i < 20; i++) // Nested iterators over the same list
+    {
+        TEST_ASSERT_EQUAL(
+            number_address_of(i % 10 + 1), list_iter_peek(&outer)
+        );
+        int* element = list_iter_next(&outer);
+        ListIter inner;
+        list_iter_init(&inner, list);
+        int count = 0;
+        while (list_iter_has_next(&inner))
+        {
+            count += list_iter_next(&inner) == element ? 1 : 0;
+        }
+        TEST_ASSERT_EQUAL(2, count);
+    }
+    TEST_ASSERT_FALSE(list_iter_has_next(&outer));
+    TEST_ASSERT_NULL(list_iter_peek(&outer));
+}
+
+void test_list_iter_remove()
+{
+    ListIter iter;
+    list_iter_init(&iter, list);
+    TEST_ASSERT_NULL(list_iter_remove(&iter));
+    for (int i = 0; i < 5; i++) // Enough elements for several nodes
+    {
+        insert_numbers(1, 10);
+    }
+    list_iter_init(&iter, list);
+    while (list_iter_has_next(&iter)) // Keeps only the odd numbers
+    {
+        int* element = list_iter_next(&iter);
+        if (*element % 2 == 0)
+        {
+            TEST_ASSERT_EQUAL(element, list_iter_remove(&iter));
+            TEST_ASSERT_NULL(list_iter_remove(&iter));
+        }
+    }
+    TEST_ASSERT_EQUAL(25, list_size(list));
+    for (int i = 0; i < 25; i++)
+    {
+        TEST_ASSERT_EQUAL(number_address_of(i % 5 * 2 + 1), list_get(list, i));
+    }
+    TEST_ASSERT_EQUAL(number_address_of(9), list_get_last(list));
+    list_iter_init(&iter, list);
+    while (list_iter_has_next(&iter)) // Removes everything
+    {
+        list_iter_next(&iter);
+        list_iter_remove(&iter);
+    }
+    TEST_ASSERT_TRUE(list_is_empty(list));
+    TEST_ASSERT_NULL(list_get_last(list));
+    insert_number(3); // Head and tail must be usable again
+    TEST_ASSERT_EQUAL(number_address_of(3), list_get_first(list));
+    TEST_ASSERT_EQUAL(number_address_of(3), list_get_last(list));
+}
+
+void test_list_iter_insert()
+{
+    ListIter iter;
+    list_iter_init(&iter, list);
+    list_iter_insert_after(&iter, number_address_of(1)); // Into an empty list
+    TEST_ASSERT_FALSE(list_iter_has_next(&iter));
+    TEST_ASSERT_EQUAL(1, list_size(list));
+    list_make_empty(list, NULL);
+    insert_numbers(1, 10);
+    insert_numbers(1, 10);
+    int* expected[100];
+    int size = 0;
+    list_iter_init(&iter, list);
+    while (list_iter_has_next(&iter)) // Surrounds every element
+    {
+        int* element = list_iter_next(&iter);
+        list_iter_insert_before(&iter, number_address_of(9));
+        list_iter_insert_after(&iter, number_address_of(8));
+        list_iter_insert_after(&iter, number_address_of(7));
+        expected[size++] = number_address_of(9);
+        expected[size++] = element;
+        expected[size++] = number_address_of(8);
+        expected[size++] = number_address_of(7);
+    }
+    list_iter_insert_after(&iter, number_address_of(6)); // At the end
+    expected[size++] = number_address_of(6);
+    TEST_ASSERT_EQUAL(size, list_size(list));
+    int* array[100];
+    list_to_array(list, (void**)array);
+    for (int i = 0; i < size; i++)
+    {
+        TEST_ASSERT_EQUAL(expected[i], array[i]);
+        TEST_ASSERT_EQUAL(expected[i], list_get(list, i));
+    }
+    TEST_ASSERT_EQUAL(number_address_of(6), list_get_last(list));
+    insert_number(5); // The tail must be right
+    TEST_ASSERT_EQUAL(number_address_of(5), list_get(list, size));
+}
+
+void check_iter_previous()
+{
+    ListIter iter;
+    list_iter_init_last(&iter, list);
+    TEST_ASSERT_FALSE(list_iter_has_previous(&iter));
+    TEST_ASSERT_NULL(list_iter_previous(&iter));
+    for (int i = 0; i < 5; i++) // Enough elements for several nodes
+    {
+        insert_numbers(1, 10);
+    }
+    list_iter_init_last(&iter, list);
+    for (int i = 49; i >= 0; i--) // Backwards over the whole list
+    {
+        TEST_ASSERT_TRUE(list_iter_has_previous(&iter));
+        TEST_ASSERT_EQUAL(
+            number_address_of(i % 10 + 1), list_iter_previous(&iter)
+        );
+    }
+    TEST_ASSERT_FALSE(list_iter_has_previous(&iter));
+    TEST_ASSERT_EQUAL(number_address_of(1), list_iter_next(&iter)); // Turns
+    TEST_ASSERT_EQUAL(number_address_of(1), list_iter_previous(&iter));
+    list_iter_init_last(&iter, list);
+    while (list_iter_has_previous(&iter)) // Keeps only the odd numbers, and
+    {                                     // puts a 1 before each 9
+        int* element = list_iter_previous(&iter);
+        if (*element % 2 == 0)
+        {
+            TEST_ASSERT_EQUAL(element, list_iter_remove(&iter));
+        }
+        else if (*element == 9)
+        {
+            list_iter_insert_before(&iter, number_address_of(1));
+        }
+    }
+    TEST_ASSERT_EQUAL(30, list_size(list));
+    int expected[] = {1, 3, 5, 7, 1, 9};
+    for (int i = 0; i < 30; i++)
+    {
+        TEST_ASSERT_EQUAL(
+            number_address_of(expected[i % 6]), list_get(list, i)
+        );
+    }
+    TEST_ASSERT_EQUAL(number_address_of(9), list_get_last(list));
+    while (list_iter_has_next(&iter)) // Removes everything, going forward
+    {
+        list_iter_next(&iter);
+        list_iter_remove(&iter);
+    }
+    TEST_ASSERT_TRUE(list_is_empty(list));
+}
+
+void test_list_iter_previous()
+{
+    check_iter_previous(); // O(n) each step, walking from the head
+    List singly = list;
+    list = list_create_doubly();
+    check_iter_previous(); // O(1) each step
+    list_destroy(list, NULL);
+    list = singly;
+}
+
+void test_list_index_limits()
+{
+#ifdef LIST_SIZE_64
+    TEST_ASSERT_EQUAL(sizeof(ptrdiff_t), sizeof(ListIndex));
+    TEST_ASSERT_TRUE(LIST_INDEX_MAX == PTRDIFF_MAX);
+#else
+    TEST_ASSERT_EQUAL(sizeof(int), sizeof(ListIndex));
+    TEST_ASSERT_TRUE(LIST_INDEX_MAX == INT_MAX);
+#endif
+    ListIndex max = LIST_INDEX_MAX;
+    insert_numbers(1, 3); // Range checks must not overflow near the limit
+    TEST_ASSERT_NULL(list_get(list, max));
+    TEST_ASSERT_NULL(list_remove(list, max));
+    list_insert(list, number_address_of(4), max);
+    TEST_ASSERT_NULL(list_get_sublist_between(list, max - 1, max));
+    TEST_ASSERT_NULL(list_get(list, -max - 1));
+    TEST_ASSERT_EQUAL_INT64(3, list_size(list));
+    TEST_ASSERT_EQUAL(number_address_of(3), list_get_last(list));
+}
+
+#ifdef LIST_SIZE_64
+
+void test_list_size_64()
+{
+    insert_numbers(1, 3);
+    ListIndex far = (ListIndex)1 << 32; // Would be position 0 if cut to int
+    TEST_ASSERT_NULL(list_get(list, far));
+    TEST_ASSERT_NULL(list_remove(list, far));
+    list_insert(list, number_address_of(4), far); // Out of range, so ignored
+    TEST_ASSERT_NULL(list_get_sublist_between(list, far, far + 2));
+    TEST_ASSERT_EQUAL_INT64(3, list_size(list));
+    TEST_ASSERT_EQUAL(number_address_of(1), list_get_first(list));
+    ListIndex indexes[] = {far, 1, far + 2}; // Only 1 is in range
+    List l = list_get_sublist(list, indexes, 3);
+    TEST_ASSERT_EQUAL_INT64(1, list_size(l));
+    TEST_ASSERT_EQUAL(number_address_of(2), list_get_first(l));
+    list_destroy(l, NULL);
+}
+
+#define HUGE_SIZE ((ListIndex)INT_MAX + 3) // Positions past INT_MAX
+
+void test_list_beyond_int_max()
+{
+    if (getenv("LIST_TEST_HUGE") == NULL) // Tens of GB, so only on request
+    {
+        TEST_IGNORE_MESSAGE("Set LIST_TEST_HUGE to run it (tens of GB)");
+    }
+    List huge = list_create_pooled(1 << 20); // Nodes come from big chunks,
+                                             // not one malloc each
+    void* block[4096];
+    for (int i = 0; i < 4096; i++)
+    {
+        block[i] = number_address_of(1);
+    }
+    for (ListIndex size = 0; size < HUGE_SIZE - 1; size += 4096)
+    {
+        ListIndex count = HUGE_SIZE - 1 - size;
+        list_insert_last_bulk(huge, block, count < 4096 ? count : 4096);
+    }
+    list_insert_last(huge, number_address_of(2)); // The only other element
+    TEST_ASSERT_EQUAL_INT64(HUGE_SIZE, list_size(huge));
+    TEST_ASSERT_EQUAL_INT64(
+        HUGE_SIZE - 1, list_find(huge, is_equal, number_address_of(2))
+    );
+    TEST_ASSERT_EQUAL(number_address_of(2), list_get(huge, HUGE_SIZE - 1));
+    list_insert(huge, number_address_of(3), HUGE_SIZE - 1);
+    TEST_ASSERT_EQUAL(number_address_of(3), list_get(huge, HUGE_SIZE - 1));
+    TEST_ASSERT_EQUAL(number_address_of(3), list_remove(huge, HUGE_SIZE - 1));
+    TEST_ASSERT_EQUAL_INT64(
+        HUGE_SIZE - 1, list_count_all(huge, is_equal, number_address_of(1))
+    );
+    List tail = list_get_sublist_between(huge, HUGE_SIZE - 2, HUGE_SIZE - 1);
+    TEST_ASSERT_EQUAL_INT64(2, list_size(tail));
+    TEST_ASSERT_EQUAL(number_address_of(2), list_get_last(tail));
+    list_destroy(tail, NULL);
+    list_destroy(huge, NULL);
+}
+
+#endif
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -371,6 +1135,7 @@ int main(void)
     RUN_TEST(test_list_get_first);
     RUN_TEST(test_list_get_last);
     RUN_TEST(test_list_get);
+    RUN_TEST(test_list_get_sequential);
     RUN_TEST(test_list_find);
     RUN_TEST(test_list_insert_first);
     RUN_TEST(test_list_insert_last);
@@ -381,14 +1146,40 @@ int main(void)
     RUN_TEST(test_list_make_empty);
     RUN_TEST(test_list_to_array);
     RUN_TEST(test_list_make_empty_free_elements);
+    RUN_TEST(test_list_from_array);
+    RUN_TEST(test_list_insert_last_bulk);
     RUN_TEST(test_list_count_all);
     RUN_TEST(test_list_remove_all);
     RUN_TEST(test_list_remove_all_custom_free);
     RUN_TEST(test_list_remove_duplicates);
+    RUN_TEST(test_list_unique);
     RUN_TEST(test_list_join);
+    RUN_TEST(test_list_splice);
+    RUN_TEST(test_list_splice_pooled);
+    RUN_TEST(test_list_sort);
+    RUN_TEST(test_list_sort_stable);
     RUN_TEST(test_list_get_sublist_between);
     RUN_TEST(test_list_get_sublist);
     RUN_TEST(test_list_map);
+    RUN_TEST(test_list_map_inplace);
+    RUN_TEST(test_list_for_each);
     RUN_TEST(test_list_filter);
+    RUN_TEST(test_list_retain);
+    RUN_TEST(test_list_reduce);
+    RUN_TEST(test_list_any_all_find_if);
+    RUN_TEST(test_list_create_pooled);
+    RUN_TEST(test_list_many_elements);
+    RUN_TEST(test_list_create_doubly);
+    RUN_TEST(test_list_set_indexed);
+    RUN_TEST(test_list_set_hash_index);
+    RUN_TEST(test_list_iter);
+    RUN_TEST(test_list_iter_remove);
+    RUN_TEST(test_list_iter_insert);
+    RUN_TEST(test_list_iter_previous);
+    RUN_TEST(test_list_index_limits);
+#ifdef LIST_SIZE_64
+    RUN_TEST(test_list_size_64);
+    RUN_TEST(test_list_beyond_int_max);
+#endif
     return UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "unity/unity.h"
+
+#include "../src/list_inline.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+List list;
+
+int numbers[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+void setUp(void) { list = list_create(); }
+
+void tearDown(void) { list_destroy(list, NULL); }
+
+/*******************************************************************************
+ Tests. Each inline accessor must agree with the out-of-line one, called as
+ (name)(list) so the macro does not expand.
+ ******************************************************************************/
+
+void check_accessors()
+{
+    TEST_ASSERT_EQUAL((list_size)(list), list_size(list));
+    TEST_ASSERT_EQUAL((list_is_empty)(list), list_is_empty(list));
+    TEST_ASSERT_EQUAL((list_get_first)(list), list_get_first(list));
+    TEST_ASSERT_EQUAL((list_get_last)(list), list_get_last(list));
+}
+
+void test_list_inline_accessors()
+{
+    check_accessors(); // Empty
+    for (int i = 0; i < 10; i++)
+    {
+        list_insert_last(list, &numbers[i]);
+        check_accessors();
+    }
+    TEST_ASSERT_EQUAL(10, list_size(list));
+    TEST_ASSERT_EQUAL(&numbers[0], list_get_first(list));
+    TEST_ASSERT_EQUAL(&numbers[9], list_get_last(list));
+    while (!list_is_empty(list)) // Down to empty again
+    {
+        list_remove_first(list);
+        check_accessors();
+    }
+    TEST_ASSERT_NULL(list_get_first(list));
+    TEST_ASSERT_NULL(list_get_last(list));
+}
+
+void test_list_inline_iterator()
+{
+    for (int i = 0; i < 10; i++)
+    {
+        list_insert_last(list, &numbers[i]);
+    }
+    list_iterator_start(list);
+    for (int i = 0; i < 10; i++) // Alternates inline and out-of-line steps,
+    {                            // which share the same cursor
+        TEST_ASSERT_TRUE(list_iterator_has_next(list));
+        TEST_ASSERT_TRUE((list_iterator_has_next)(list));
+        void* element = i % 2 == 0 ? list_iterator_get_next(list)
+                                   : (list_iterator_get_next)(list);
+        TEST_ASSERT_EQUAL(&numbers[i], element);
+    }
+    TEST_ASSERT_FALSE(list_iterator_has_next(list));
+    TEST_ASSERT_FALSE((list_iterator_has_next)(list));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_list_inline_accessors);
+    RUN_TEST(test_list_inline_iterator);
+    return UNITY_END();
+}
@@ -0,0 +1,135 @@
+#include "unity/unity.h"
+
+#include "../src/list_parallel.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define SIZE 10000
+
+List list;
+int numbers[SIZE];
+int doubles[SIZE];
+
+void setUp(void)
+{
+    list = list_create();
+    for (int i = 0; i < SIZE; i++)
+    {
+        numbers[i] = i;
+        list_insert_last(list, &numbers[i]);
+    }
+}
+
+void tearDown(void) { list_destroy(list, NULL); }
+
+/*******************************************************************************
+ Helper functions.
+ ******************************************************************************/
+
+void* double_of(void* number) { return &doubles[*(int*)number]; }
+
+bool is_multiple_of_three(void* number) { return *(int*)number % 3 == 0; }
+
+void assert_same_lists(List expected, List actual)
+{
+    TEST_ASSERT_EQUAL(list_size(expected), list_size(actual));
+    list_iterator_start(expected);
+    list_iterator_start(actual);
+    while (list_iterator_has_next(expected))
+    {
+        TEST_ASSERT_EQUAL(
+            list_iterator_get_next(expected), list_iterator_get_next(actual)
+        );
+    }
+    TEST_ASSERT_FALSE(list_iterator_has_next(actual));
+    if (!list_is_empty(actual)) // The tail must be linked right too
+    {
+        TEST_ASSERT_EQUAL(list_get_last(expected), list_get_last(actual));
+    }
+}
+
+/*******************************************************************************
+ Tests.
+ ******************************************************************************/
+
+void test_list_map_parallel()
+{
+    List expected = list_map(list, double_of);
+    int threads[] = {1, 3, 8, 0};
+    for (int i = 0; i < 4; i++)
+    {
+        List actual = list_map_parallel(list, double_of, threads[i]);
+        assert_same_lists(expected, actual);
+        list_destroy(actual, NULL);
+    }
+    list_destroy(expected, NULL);
+}
+
+void test_list_filter_parallel()
+{
+    List expected = list_filter(list, is_multiple_of_three);
+    int threads[] = {1, 3, 8, 0};
+    for (int i = 0; i < 4; i++)
+    {
+        List actual =
+            list_filter_parallel(list, is_multiple_of_three, threads[i]);
+        assert_same_lists(expected, actual);
+        list_destroy(actual, NULL);
+    }
+    list_destroy(expected, NULL);
+}
+
+void test_list_parallel_small_lists()
+{
+    list_make_empty(list, NULL);
+    List actual = list_map_parallel(list, double_of, 4);
+    TEST_ASSERT_TRUE(list_is_empty(actual));
+    list_destroy(actual, NULL);
+    list_insert_last(list, &numbers[3]);
+    list_insert_last(list, &numbers[4]);
+    actual = list_filter_parallel(list, is_multiple_of_three, 4);
+    TEST_ASSERT_EQUAL(1, list_size(actual));
+    TEST_ASSERT_EQUAL(&numbers[3], list_get_first(actual));
+    list_insert_last(actual, &numbers[5]);
+    TEST_ASSERT_EQUAL(&numbers[5], list_get(actual, 1));
+    list_destroy(actual, NULL);
+}
+
+void test_list_parallel_many_threads()
+{
+    List expected = list_map(list, double_of);
+    for (int i = 0; i < 3; i++) // Later calls reuse the same threads
+    {
+        List actual = list_map_parallel(list, double_of, INT_MAX); // Clamped
+        assert_same_lists(expected, actual);
+        list_destroy(actual, NULL);
+    }
+    list_destroy(expected, NULL);
+}
+
+void test_list_parallel_shutdown()
+{
+    List expected = list_map(list, double_of);
+    for (int i = 0; i < 3; i++) // Calls after a shutdown start threads again
+    {
+        List actual = list_map_parallel(list, double_of, 2 + 3 * i);
+        assert_same_lists(expected, actual);
+        list_destroy(actual, NULL);
+        list_parallel_shutdown();
+    }
+    list_parallel_shutdown(); // Nothing to stop
+    list_destroy(expected, NULL);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_list_map_parallel);
+    RUN_TEST(test_list_filter_parallel);
+    RUN_TEST(test_list_parallel_small_lists);
+    RUN_TEST(test_list_parallel_many_threads);
+    RUN_TEST(test_list_parallel_shutdown);
+    return UNITY_END();
+}
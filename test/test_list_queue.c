@@ -0,0 +1,168 @@
+#include "unity/unity.h"
+
+#include "../src/list_queue.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define THREADS 4        // Producers, and as many consumers
+#define PER_THREAD 20000 // Elements inserted by each producer
+
+ListQueue queue;
+
+int numbers[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+int values[THREADS * PER_THREAD];
+atomic_int seen[THREADS * PER_THREAD]; // Times each value was removed
+atomic_bool producing;                 // Until every producer is done
+
+void setUp(void) { queue = list_queue_create(); }
+
+void tearDown(void) { list_queue_destroy(queue, NULL); }
+
+/*******************************************************************************
+ Helper functions.
+ ******************************************************************************/
+
+void* produce(void* argument)
+{
+    int producer = *(int*)argument;
+    for (int i = 0; i < PER_THREAD; i++)
+    {
+        list_queue_insert_last(queue, &values[producer * PER_THREAD + i]);
+    }
+    return NULL;
+}
+
+void* consume(void* argument)
+{
+    int* consumed = argument; // Elements removed, or -1 if out of order
+    int last[THREADS];        // Last value removed from each producer
+    for (int i = 0; i < THREADS; i++)
+    {
+        last[i] = -1;
+    }
+    while (true)
+    {
+        bool done = !atomic_load(&producing); // Before removing, so an empty
+        int* value = list_queue_remove_first(queue); // queue after it is final
+        if (value == NULL)
+        {
+            if (done)
+            {
+                break;
+            }
+            continue;
+        }
+        int producer = *value / PER_THREAD;
+        if (*value <= last[producer]) // FIFO per producer
+        {
+            *consumed = -1;
+            break;
+        }
+        last[producer] = *value;
+        atomic_fetch_add(&seen[*value], 1);
+        (*consumed)++;
+    }
+    return NULL;
+}
+
+void free_number(void* number) { *(int*)number = 0; }
+
+/*******************************************************************************
+ Tests.
+ ******************************************************************************/
+
+void test_list_queue_is_empty()
+{
+    TEST_ASSERT_TRUE(list_queue_is_empty(queue));
+    TEST_ASSERT_EQUAL(0, list_queue_size(queue));
+    TEST_ASSERT_NULL(list_queue_remove_first(queue));
+    list_queue_insert_last(queue, &numbers[0]);
+    TEST_ASSERT_FALSE(list_queue_is_empty(queue));
+    TEST_ASSERT_EQUAL(1, list_queue_size(queue));
+}
+
+void test_list_queue_order()
+{
+    for (int i = 0; i < 10; i++)
+    {
+        list_queue_insert_last(queue, &numbers[i]);
+    }
+    for (int i = 0; i < 5; i++)
+    {
+        TEST_ASSERT_EQUAL(&numbers[i], list_queue_remove_first(queue));
+    }
+    list_queue_insert_last(queue, &numbers[0]);
+    for (int i = 5; i < 10; i++)
+    {
+        TEST_ASSERT_EQUAL(&numbers[i], list_queue_remove_first(queue));
+    }
+    TEST_ASSERT_EQUAL(&numbers[0], list_queue_remove_first(queue));
+    TEST_ASSERT_NULL(list_queue_remove_first(queue));
+}
+
+void test_list_queue_destroy_free_elements()
+{
+    int leftovers[] = {1, 2, 3};
+    ListQueue other = list_queue_create();
+    for (int i = 0; i < 3; i++)
+    {
+        list_queue_insert_last(other, &leftovers[i]);
+    }
+    list_queue_remove_first(other);
+    list_queue_destroy(other, free_number);
+    TEST_ASSERT_EQUAL(1, leftovers[0]); // Removed before, not freed
+    TEST_ASSERT_EQUAL(0, leftovers[1]);
+    TEST_ASSERT_EQUAL(0, leftovers[2]);
+}
+
+void test_list_queue_threads()
+{
+    pthread_t producers[THREADS];
+    pthread_t consumers[THREADS];
+    int ids[THREADS];
+    int consumed[THREADS];
+    for (int i = 0; i < THREADS * PER_THREAD; i++)
+    {
+        values[i] = i;
+        atomic_init(&seen[i], 0);
+    }
+    atomic_store(&producing, true);
+    for (int i = 0; i < THREADS; i++)
+    {
+        ids[i] = i;
+        consumed[i] = 0;
+        pthread_create(&consumers[i], NULL, consume, &consumed[i]);
+        pthread_create(&producers[i], NULL, produce, &ids[i]);
+    }
+    for (int i = 0; i < THREADS; i++)
+    {
+        pthread_join(producers[i], NULL);
+    }
+    atomic_store(&producing, false);
+    int total = 0;
+    for (int i = 0; i < THREADS; i++)
+    {
+        pthread_join(consumers[i], NULL);
+        TEST_ASSERT_NOT_EQUAL(-1, consumed[i]);
+        total += consumed[i];
+    }
+    TEST_ASSERT_EQUAL(THREADS * PER_THREAD, total);
+    for (int i = 0; i < THREADS * PER_THREAD; i++) // Each one exactly once
+    {
+        TEST_ASSERT_EQUAL(1, atomic_load(&seen[i]));
+    }
+    TEST_ASSERT_TRUE(list_queue_is_empty(queue));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_list_queue_is_empty);
+    RUN_TEST(test_list_queue_order);
+    RUN_TEST(test_list_queue_destroy_free_elements);
+    RUN_TEST(test_list_queue_threads);
+    return UNITY_END();
+}
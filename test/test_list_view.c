@@ -0,0 +1,120 @@
+#include "unity/unity.h"
+
+#include "../src/list_view.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+List list;
+ListView view;
+
+int numbers[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+int calls; // Stage calls, to check each element goes through once
+
+void setUp(void)
+{
+    list = list_create();
+    for (int i = 0; i < 10; i++)
+    {
+        list_insert_last(list, &numbers[i]);
+    }
+    view = list_view(list);
+    calls = 0;
+}
+
+void tearDown(void)
+{
+    view_destroy(view);
+    list_destroy(list, NULL);
+}
+
+/*******************************************************************************
+ Helper functions.
+ ******************************************************************************/
+
+void* half_of(void* number) // Maps to the number with half the value
+{
+    calls++;
+    return &numbers[*(int*)number / 2 - 1];
+}
+
+bool is_even(void* number)
+{
+    calls++;
+    return *(int*)number % 2 == 0;
+}
+
+void* add(void* sum, void* number, void* ctx)
+{
+    (void)ctx;
+    *(int*)sum += *(int*)number;
+    return sum;
+}
+
+void* count_into(void* count, void* number, void* ctx)
+{
+    (void)number;
+    (*(int*)ctx)++;
+    return count;
+}
+
+/*******************************************************************************
+ Tests.
+ ******************************************************************************/
+
+void test_view_without_stages()
+{
+    int sum = 0;
+    TEST_ASSERT_EQUAL(&sum, view_reduce(view, &sum, add, NULL));
+    TEST_ASSERT_EQUAL(55, sum);
+    List copy = view_to_list(view);
+    TEST_ASSERT_EQUAL(10, list_size(copy));
+    TEST_ASSERT_EQUAL(&numbers[9], list_get_last(copy));
+    list_destroy(copy, NULL);
+}
+
+void test_view_stages()
+{
+    view_filter(view, is_even);
+    view_map(view, half_of);
+    view_filter(view, is_even);
+    TEST_ASSERT_EQUAL(0, calls); // Nothing runs until a result is asked for
+    List result = view_to_list(view);
+    TEST_ASSERT_EQUAL(20, calls); // 10 filtered, then 5 mapped and filtered
+    TEST_ASSERT_EQUAL(2, list_size(result));
+    TEST_ASSERT_EQUAL(&numbers[1], list_get(result, 0));
+    TEST_ASSERT_EQUAL(&numbers[3], list_get(result, 1));
+    list_destroy(result, NULL);
+    int sum = 0;
+    view_reduce(view, &sum, add, NULL);
+    TEST_ASSERT_EQUAL(6, sum);
+}
+
+void test_view_same_as_chained()
+{
+    List filtered = list_filter(list, is_even);
+    List expected = list_map(filtered, half_of);
+    view_filter(view, is_even);
+    view_map(view, half_of);
+    List actual = view_to_list(view);
+    TEST_ASSERT_EQUAL(list_size(expected), list_size(actual));
+    for (int i = 0; i < list_size(expected); i++)
+    {
+        TEST_ASSERT_EQUAL(list_get(expected, i), list_get(actual, i));
+    }
+    int count = 0;
+    view_reduce(view, NULL, count_into, &count);
+    TEST_ASSERT_EQUAL(5, count);
+    list_destroy(actual, NULL);
+    list_destroy(expected, NULL);
+    list_destroy(filtered, NULL);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_view_without_stages);
+    RUN_TEST(test_view_stages);
+    RUN_TEST(test_view_same_as_chained);
+    return UNITY_END();
+}
@@ -0,0 +1,141 @@
+#include "unity/unity.h"
+
+#include "../src/persistent_list.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+PersistentList list;
+
+int numbers[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+void setUp(void) { list = NULL; }
+
+void tearDown(void) { persistent_list_release(list); }
+
+/*******************************************************************************
+ Helper functions.
+ ******************************************************************************/
+
+int* number_address_of(int number) { return &(numbers[number - 1]); }
+
+PersistentList numbers_list(int start, int end) // From start to end
+{
+    PersistentList result = NULL;
+    for (int i = end; i >= start; i--)
+    {
+        PersistentList longer =
+            persistent_list_prepend(result, number_address_of(i));
+        persistent_list_release(result);
+        result = longer;
+    }
+    return result;
+}
+
+void assert_numbers(PersistentList actual, int expected[], int count)
+{
+    TEST_ASSERT_EQUAL(count, persistent_list_size(actual));
+    for (int i = 0; i < count; i++)
+    {
+        TEST_ASSERT_EQUAL(
+            number_address_of(expected[i]), persistent_list_get(actual, i)
+        );
+    }
+}
+
+/*******************************************************************************
+ Tests.
+ ******************************************************************************/
+
+void test_persistent_list_empty()
+{
+    TEST_ASSERT_EQUAL(0, persistent_list_size(list));
+    TEST_ASSERT_NULL(persistent_list_first(list));
+    TEST_ASSERT_NULL(persistent_list_get(list, 0));
+    TEST_ASSERT_NULL(persistent_list_rest(list));
+    TEST_ASSERT_NULL(persistent_list_suffix(list, 2));
+}
+
+void test_persistent_list_prepend_shares()
+{
+    list = numbers_list(2, 4);
+    PersistentList longer = persistent_list_prepend(list, number_address_of(1));
+    int expected[] = {1, 2, 3, 4};
+    assert_numbers(longer, expected, 4);
+    assert_numbers(list, expected + 1, 3); // The old version is unchanged
+    PersistentList rest = persistent_list_rest(longer);
+    TEST_ASSERT_EQUAL(list, rest); // Same nodes, not a copy
+    PersistentList suffix = persistent_list_suffix(longer, 2);
+    TEST_ASSERT_EQUAL(persistent_list_rest(list), suffix);
+    persistent_list_release(suffix); // Released twice, as acquired twice
+    persistent_list_release(suffix);
+    persistent_list_release(rest);
+    persistent_list_release(longer);
+    assert_numbers(list, expected + 1, 3); // Still alive
+}
+
+void test_persistent_list_insert_remove_set()
+{
+    list = numbers_list(1, 5);
+    PersistentList inserted =
+        persistent_list_insert(list, number_address_of(9), 2);
+    PersistentList removed = persistent_list_remove(inserted, 0);
+    PersistentList set = persistent_list_set(removed, number_address_of(8), 3);
+    int original[] = {1, 2, 3, 4, 5};
+    int after_insert[] = {1, 2, 9, 3, 4, 5};
+    int after_set[] = {2, 9, 3, 8, 5};
+    assert_numbers(list, original, 5);
+    assert_numbers(inserted, after_insert, 6);
+    assert_numbers(removed, after_insert + 1, 5);
+    assert_numbers(set, after_set, 5);
+    PersistentList tail = persistent_list_suffix(list, 2); // Shared by inserted
+    PersistentList inserted_tail = persistent_list_suffix(inserted, 3);
+    TEST_ASSERT_EQUAL(tail, inserted_tail);
+    PersistentList same = persistent_list_remove(list, 5); // Out of range
+    TEST_ASSERT_EQUAL(list, same);
+    persistent_list_release(same);
+    persistent_list_release(inserted_tail);
+    persistent_list_release(tail);
+    persistent_list_release(inserted);
+    persistent_list_release(removed);
+    assert_numbers(set, after_set, 5);
+    persistent_list_release(set);
+}
+
+void test_persistent_list_many_versions()
+{
+    List source = list_create();
+    for (int i = 0; i < 100000; i++)
+    {
+        list_insert_last(source, number_address_of(i % 10 + 1));
+    }
+    list = persistent_list_from_list(source);
+    PersistentList versions[1000]; // Each one a node more, not a copy
+    versions[0] = persistent_list_prepend(list, number_address_of(1));
+    for (int i = 1; i < 1000; i++)
+    {
+        versions[i] =
+            persistent_list_prepend(versions[i - 1], number_address_of(2));
+    }
+    TEST_ASSERT_EQUAL(101000, persistent_list_size(versions[999]));
+    List copy = persistent_list_to_list(versions[999]);
+    TEST_ASSERT_EQUAL(101000, list_size(copy));
+    TEST_ASSERT_EQUAL(number_address_of(1), list_get(copy, 999));
+    TEST_ASSERT_EQUAL(list_get_last(source), list_get_last(copy));
+    for (int i = 0; i < 1000; i++)
+    {
+        persistent_list_release(versions[i]);
+    }
+    list_destroy(copy, NULL);
+    list_destroy(source, NULL);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_persistent_list_empty);
+    RUN_TEST(test_persistent_list_prepend_shares);
+    RUN_TEST(test_persistent_list_insert_remove_set);
+    RUN_TEST(test_persistent_list_many_versions);
+    return UNITY_END();
+}
@@ -0,0 +1,155 @@
+#include "unity/unity.h"
+
+#include "../src/typed_list.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define INT_EQUAL(a, b) ((a) == (b))
+
+DEFINE_LIST(IntList, int_list, int, INT_EQUAL)
+
+typedef struct
+{
+        int x;
+        int y;
+} Point;
+
+bool point_equal(Point a, Point b) { return a.x == b.x && a.y == b.y; }
+
+DEFINE_LIST(PointList, point_list, Point, point_equal)
+
+IntList list;
+
+void setUp(void) { list = int_list_create(); }
+
+void tearDown(void) { int_list_destroy(list); }
+
+/*******************************************************************************
+ Helper functions.
+ ******************************************************************************/
+
+void insert_numbers(int start, int end)
+{
+    for (int i = start; i <= end; i++)
+    {
+        int_list_insert_last(list, i);
+    }
+}
+
+/*******************************************************************************
+ Tests
+ ******************************************************************************/
+
+void test_int_list_is_empty() { TEST_ASSERT(int_list_is_empty(list)); }
+
+void test_int_list_get()
+{
+    TEST_ASSERT_NULL(int_list_get(list, 0));
+    TEST_ASSERT_NULL(int_list_get_first(list));
+    TEST_ASSERT_NULL(int_list_get_last(list));
+    insert_numbers(1, 5);
+    TEST_ASSERT_EQUAL(5, int_list_size(list));
+    TEST_ASSERT_EQUAL(2, *int_list_get(list, 1));
+    TEST_ASSERT_EQUAL(1, *int_list_get_first(list));
+    TEST_ASSERT_EQUAL(5, *int_list_get_last(list));
+    *int_list_get(list, 1) = 20; // Elements live inside the nodes
+    TEST_ASSERT_EQUAL(20, *int_list_get(list, 1));
+}
+
+void test_int_list_insert()
+{
+    int_list_insert(list, 1, 1);
+    TEST_ASSERT_TRUE(int_list_is_empty(list));
+    int_list_insert(list, 1, 0);
+    int_list_insert_first(list, 0);
+    int_list_insert(list, 3, 2);
+    int_list_insert(list, 2, 2);
+    int array[4];
+    int_list_to_array(list, array);
+    for (int i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_EQUAL(i, array[i]);
+    }
+    TEST_ASSERT_EQUAL(3, *int_list_get_last(list));
+}
+
+void test_int_list_remove()
+{
+    int element = -1;
+    TEST_ASSERT_FALSE(int_list_remove_first(list, &element));
+    TEST_ASSERT_FALSE(int_list_remove_last(list, &element));
+    TEST_ASSERT_FALSE(int_list_remove(list, 0, &element));
+    insert_numbers(1, 6);
+    TEST_ASSERT_TRUE(int_list_remove_first(list, &element));
+    TEST_ASSERT_EQUAL(1, element);
+    TEST_ASSERT_TRUE(int_list_remove_last(list, &element));
+    TEST_ASSERT_EQUAL(6, element);
+    TEST_ASSERT_EQUAL(5, *int_list_get_last(list));
+    TEST_ASSERT_TRUE(int_list_remove(list, 1, NULL));
+    TEST_ASSERT_EQUAL(3, int_list_size(list));
+    TEST_ASSERT_EQUAL(4, *int_list_get(list, 1));
+    int_list_make_empty(list);
+    TEST_ASSERT_TRUE(int_list_is_empty(list));
+}
+
+void test_int_list_find_and_count()
+{
+    TEST_ASSERT_EQUAL(-1, int_list_find(list, 3));
+    insert_numbers(1, 5);
+    insert_numbers(2, 3);
+    TEST_ASSERT_EQUAL(2, int_list_find(list, 3));
+    TEST_ASSERT_EQUAL(2, int_list_count_all(list, 3));
+    TEST_ASSERT_EQUAL(0, int_list_count_all(list, 9));
+}
+
+void test_int_list_remove_all()
+{
+    insert_numbers(1, 3);
+    insert_numbers(1, 3);
+    TEST_ASSERT_EQUAL(2, int_list_remove_all(list, 3));
+    TEST_ASSERT_EQUAL(4, int_list_size(list));
+    TEST_ASSERT_EQUAL(2, *int_list_get_last(list));
+    TEST_ASSERT_EQUAL(2, int_list_remove_duplicates(list, 1));
+    TEST_ASSERT_EQUAL(3, int_list_size(list));
+    TEST_ASSERT_EQUAL(1, *int_list_get_first(list));
+    TEST_ASSERT_EQUAL(2, int_list_count_all(list, 2));
+}
+
+void test_int_list_iterator()
+{
+    insert_numbers(1, 3);
+    int_list_iterator_start(list);
+    for (int i = 1; i <= 3; i++)
+    {
+        TEST_ASSERT_TRUE(int_list_iterator_has_next(list));
+        TEST_ASSERT_EQUAL(i, *int_list_iterator_get_next(list));
+    }
+    TEST_ASSERT_FALSE(int_list_iterator_has_next(list));
+}
+
+void test_point_list()
+{
+    PointList points = point_list_create();
+    point_list_insert_last(points, (Point){1, 2});
+    point_list_insert_last(points, (Point){3, 4});
+    point_list_insert_last(points, (Point){1, 2});
+    TEST_ASSERT_EQUAL(1, point_list_find(points, (Point){3, 4}));
+    TEST_ASSERT_EQUAL(2, point_list_count_all(points, (Point){1, 2}));
+    TEST_ASSERT_EQUAL(4, point_list_get(points, 1)->y);
+    point_list_destroy(points);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_int_list_is_empty);
+    RUN_TEST(test_int_list_get);
+    RUN_TEST(test_int_list_insert);
+    RUN_TEST(test_int_list_remove);
+    RUN_TEST(test_int_list_find_and_count);
+    RUN_TEST(test_int_list_remove_all);
+    RUN_TEST(test_int_list_iterator);
+    RUN_TEST(test_point_list);
+    return UNITY_END();
+}